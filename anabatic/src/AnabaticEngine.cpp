@@ -16,6 +16,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <memory>
 #include "hurricane/Bug.h"
 #include "hurricane/Error.h"
 #include "hurricane/Warning.h"
@@ -159,6 +160,7 @@ namespace Anabatic {
   using std::endl;
   using std::multiset;
   using std::ostringstream;
+  using std::unique_ptr;
   using Hurricane::Bug;
   using Hurricane::Error;
   using Hurricane::Warning;
@@ -365,6 +367,7 @@ namespace Anabatic {
     , _gcells           ()
     , _ovEdges          ()
     , _netOrdering      ()
+    , _ripupNets        ()
     , _netDatas         ()
     , _viewer           (NULL)
     , _flags            (Flags::DestroyBaseContact)
@@ -693,6 +696,7 @@ namespace Anabatic {
     _gutAnabatic();
     _flags.reset( Flags::DestroyMask );
     _state = EngineCreation;
+    clearRipupNets();
 
     UpdateSession::open();
     GCell::create( this );
@@ -1233,13 +1237,21 @@ namespace Anabatic {
 
     startMeasures();
     openSession();
+    Session::resetRevalidateCounts();
 
     int gaugeKind = 3;
     if (getConfiguration()->isTwoMetals()) gaugeKind = 0;
     if (getConfiguration()->isHV       ()) gaugeKind = 1;
     if (getConfiguration()->isVH       ()) gaugeKind = 2;
 
-    if (gaugeKind < 3) {
+    unique_ptr<NetBuilder> builder;
+    switch ( gaugeKind ) {
+      case 0: builder.reset( new NetBuilderM2 () ); break;
+      case 1: builder.reset( new NetBuilderHV () ); break;
+      case 2: builder.reset( new NetBuilderVH () ); break;
+    }
+
+    if (builder) {
       for ( Net* net : getCell()->getNets() ) {
         if (NetRoutingExtension::isShortNet(net)) {
         //AutoSegment::setShortNetMode( true );
@@ -1252,11 +1264,9 @@ namespace Anabatic {
           DebugSession::open( net, 145, 150 );
           AutoSegment::setAnalogMode( NetRoutingExtension::isAnalog(net) );
 
-          switch ( gaugeKind ) {
-            case 0: NetBuilder::load<NetBuilderM2>( this, net ); break;
-            case 1: NetBuilder::load<NetBuilderHV>( this, net ); break;
-            case 2: NetBuilder::load<NetBuilderVH>( this, net ); break;
-          }
+        // The builder is reused from one net to the next, its working
+        // containers keep their storage (setStartHook() clears them).
+          builder->_load( this, net );
 
           Session::revalidate();
           DebugSession::close();
@@ -1274,6 +1284,13 @@ namespace Anabatic {
     stopMeasures();
 
     cmess2 << Dots::asSizet("     - Short nets",shortNets) << endl;
+    cmess2 << Dots::asString( "     - Revalidations"
+                            , getString(Session::getRevalidateCount(Session::RevalidateCalls))
+                            + " (" + getString(Session::getRevalidateCount(Session::RevalidateEmpties))
+                            + " empty)" ) << endl;
+    cmess2 << Dots::asSizet("     - Revalidated nets"    ,Session::getRevalidateCount(Session::RevalidateNets    )) << endl;
+    cmess2 << Dots::asSizet("     - Revalidated contacts",Session::getRevalidateCount(Session::RevalidateContacts)) << endl;
+    cmess2 << Dots::asSizet("     - Revalidated segments",Session::getRevalidateCount(Session::RevalidateSegments)) << endl;
 
     if (gaugeKind > 2) {
       throw Error( "AnabaticEngine::_loadGrByNet(): Unsupported kind of routing gauge \"%s\"."
@@ -59,6 +59,7 @@ namespace Anabatic {
   const BaseFlags  Flags::GlobalRouted        = (1L <<  7);
   const BaseFlags  Flags::DetailRouted        = (1L <<  8);
   const BaseFlags  Flags::ExcludeRoute        = (1L <<  9);
+  const BaseFlags  Flags::RipupQueued         = (1L << 10);
 // Masks.                                      
   const BaseFlags  Flags::WestSide            = Horizontal|Target;
   const BaseFlags  Flags::EastSide            = Horizontal|Source;
@@ -1353,27 +1353,62 @@ namespace Anabatic {
 
 
 // -------------------------------------------------------------------
-// Class  :  "Anabatic::PrioriryQueue::CompareByDistance".
-
-  
-  PriorityQueue* PriorityQueue::CompareByDistance::_pqueue = NULL;
+// Class  :  "Anabatic::PriorityQueue".
 
 
-  bool PriorityQueue::CompareByDistance::operator() ( const Vertex* lhs, const Vertex* rhs )
+  bool PriorityQueue::_isLess ( const Vertex* lhs, const Vertex* rhs ) const
   {
-    if (lhs->getDistance() == rhs->getDistance()) {
-      if (_pqueue and _pqueue->hasAttractor()) {
-        DbU::Unit lhsDistance = _pqueue->getAttractor().manhattanDistance( lhs->getCenter() );
-        DbU::Unit rhsDistance = _pqueue->getAttractor().manhattanDistance( rhs->getCenter() );
+    DbU::Unit lhsKey = _getKey( lhs );
+    DbU::Unit rhsKey = _getKey( rhs );
+
+    if (lhsKey == rhsKey) {
+      if (hasAttractor()) {
+        DbU::Unit lhsDistance = getAttractor().manhattanDistance( lhs->getCenter() );
+        DbU::Unit rhsDistance = getAttractor().manhattanDistance( rhs->getCenter() );
 
         cdebug_log(112,0) << "CompareByDistance: lhs:" << DbU::getValueString(lhsDistance)
                           << " rhs:" << DbU::getValueString(rhsDistance) << endl;
 
         if (lhsDistance != rhsDistance) return lhsDistance < rhsDistance;
       }
-      return lhs->getBranchId() > rhs->getBranchId();
+      if (lhs->getBranchId() != rhs->getBranchId())
+        return lhs->getBranchId() > rhs->getBranchId();
+      return lhs->_qorder < rhs->_qorder;
+    }
+    return lhsKey < rhsKey;
+  }
+
+
+  void  PriorityQueue::_siftUp ( size_t index )
+  {
+    Vertex* v = _heap[index];
+    while ( index > 0 ) {
+      size_t parent = (index-1) / Arity;
+      if (not _isLess(v,_heap[parent])) break;
+      _place( _heap[parent], index );
+      index = parent;
+    }
+    _place( v, index );
+  }
+
+
+  void  PriorityQueue::_siftDown ( size_t index )
+  {
+    Vertex* v = _heap[index];
+    while ( true ) {
+      size_t first = index*Arity + 1;
+      if (first >= _heap.size()) break;
+
+      size_t last  = std::min( first+Arity, _heap.size() );
+      size_t child = first;
+      for ( size_t i=first+1 ; i<last ; ++i ) {
+        if (_isLess(_heap[i],_heap[child])) child = i;
+      }
+      if (not _isLess(_heap[child],v)) break;
+      _place( _heap[child], index );
+      index = child;
     }
-    return lhs->getDistance() < rhs->getDistance();
+    _place( v, index );
   }
 
 
@@ -1394,6 +1429,7 @@ namespace Anabatic {
     string s = "";
     s += (_flags & Standart ) ? 'S' : '-';
     s += (_flags & Monotonic) ? 'M' : '-';
+    s += (_flags & AStar    ) ? 'A' : '-';
 
     return s;
   }
@@ -1444,6 +1480,8 @@ namespace Anabatic {
     , _connectedsId  (-1)
     , _queue         ()
     , _flags         (0)
+    , _estimateScaling(1.0)
+    , _expandeds     (0)
   {
     const vector<GCell*>& gcells = _anabatic->getGCells();
     for ( GCell* gcell : gcells ) {
@@ -1927,9 +1965,27 @@ namespace Anabatic {
   }
 
 
+  void  Dijkstra::_updateEstimate ()
+  {
+  // The A* lower bound is the Manhattan distance to the area enclosing the
+  // remaining targets, scaled by the smallest cost per unit of length the
+  // distance function can return. Not used to reach a symmetry axis.
+    if (not (_mode & Mode::AStar) or needAxisTarget() or _targets.empty()) return;
+    if ((*_sources.begin())->isAnalog()) return;
+
+    Box targetArea;
+    for ( Vertex* target : _targets ) targetArea.merge( target->getBoundingBox() );
+    _queue.setEstimate( targetArea, _estimateScaling );
+
+    cdebug_log(112,0) << "A* target area: " << targetArea << endl;
+  }
+
+
   bool  Dijkstra::_propagate ( Flags enabledSides )
   {
     cdebug_log(112,1) << "Dijkstra::_propagate() " << _net <<  endl;
+    _updateEstimate();
+
     while ( not _queue.empty() ) {
       cdebug_log(111,0) << "Number of targets left: " << _targets.size()
                         << " and needaxis? " << needAxisTarget() << endl;
@@ -1946,6 +2002,7 @@ namespace Anabatic {
       if      ( current->isAxisTarget() and needAxisTarget()) unsetFlags(Mode::AxisTarget);
       else if ((current->getConnexId() == _connectedsId) or (current->getConnexId() < 0)) {
         cdebug_log(111,0) << "Looking for neighbors:" << endl;
+        ++_expandeds;
 
         for ( Edge* edge : current->getGCell()->getEdges() ) {
           cdebug_log(111,0) << "@ Edge " << edge << endl;
@@ -2015,7 +2072,7 @@ namespace Anabatic {
                 _pushEqualDistance( distance, isDistance2shorter, current, vneighbor, edge ); // ANALOG
 
               } else if (distance < vneighbor->getDistance()) {
-                if (vneighbor->getDistance() != Vertex::unreached) _queue.erase( vneighbor );
+              // If still queued, the push() below re-orders it (decrease-key).
                 cdebug_log(111,0) << "> Vertex reached through a shorter path (prev: "
                                   << DbU::getValueString(vneighbor->getDistance()) << ")" << endl;
                 push = true;
@@ -2347,7 +2404,8 @@ namespace Anabatic {
     DebugSession::open( _net, 111, 120 );
 
     cdebug_log(112,1) << "Dijkstra::run() on " << _net << " mode:" << mode << endl;
-    _mode = mode;
+    _mode      = mode;
+    _expandeds = 0;
 
     _selectFirstSource();
     if (_sources.empty()) {
@@ -2366,10 +2424,11 @@ namespace Anabatic {
 
     _queue.clear();
     _queue.setAttractor( _searchArea.getCenter() );
+    _updateEstimate();
     _connectedsId = (*_sources.begin())->getConnexId();
     for ( Vertex* source : _sources ) {
-      _queue.push( source );
       source->setDistance( 0.0 );
+      _queue.push( source );
       cdebug_log(112,0) << "Push source: (size:" << _queue.size() << ") "
                         << source
                         << " _connectedsId:" << _connectedsId << endl;
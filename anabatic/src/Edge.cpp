@@ -380,7 +380,7 @@ namespace Anabatic {
         if (not isEnding(_segments[i])) {
           NetData* netData = anabatic->getNetData( _segments[i]->getNet() );
           if (netData->isGlobalFixed ()) break;
-          if (netData->isGlobalRouted()) ++netCount;
+          if (netData->isGlobalRouted()) { ++netCount; anabatic->addRipupNet( netData ); }
           anabatic->ripup( _segments[i], Flags::Propagate );
           continue;
         }
@@ -391,7 +391,7 @@ namespace Anabatic {
       while ( _segments.size() > truncate ) {
         NetData* netData = anabatic->getNetData( _segments[truncate]->getNet() );
         if (netData->isGlobalFixed ()) break;
-        if (netData->isGlobalRouted()) ++netCount;
+        if (netData->isGlobalRouted()) { ++netCount; anabatic->addRipupNet( netData ); }
         anabatic->ripup( _segments[truncate], Flags::Propagate );
       }
       
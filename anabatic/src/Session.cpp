@@ -61,6 +61,13 @@ namespace Anabatic {
 // Class  :  "Anabatic::Session".
 
   Session*  Session::_session = NULL;
+  size_t    Session::_revalidateCounts[RevalidateCounterSize] = { 0, 0, 0, 0, 0, 0 };
+
+
+  void  Session::resetRevalidateCounts ()
+  {
+    for ( size_t i=0 ; i<RevalidateCounterSize ; ++i ) _revalidateCounts[i] = 0;
+  }
 
 
   Session* Session::get ( const char* message )
@@ -247,10 +254,27 @@ namespace Anabatic {
     cdebug_log(145,0)   << "_autoContacts.size(): " << _autoContacts.size() << endl;
 
     size_t count = 0;
+    ++_revalidateCounts[RevalidateCalls];
+
+  // Nothing has been invalidated since the last call (typically, a net
+  // already revalidated by its NetBuilder). Skip the sort & destroy pass.
+    if (    _netInvalidateds    .empty()
+       and  _autoContacts       .empty()
+       and  _segmentInvalidateds.empty()
+       and  _destroyedSegments  .empty() ) {
+      ++_revalidateCounts[RevalidateEmpties];
+      _segmentRevalidateds.clear();
+      cdebug_tabw(145,-1);
+      return 0;
+    }
 
-    if (not _netInvalidateds.empty()) _revalidateTopology();
+    if (not _netInvalidateds.empty()) {
+      _revalidateCounts[RevalidateNets] += _netInvalidateds.size();
+      _revalidateTopology();
+    }
 
     cdebug_log(145,0) << "AutoContacts Revalidate (after _revalidateTopology())." << endl;
+    _revalidateCounts[RevalidateContacts] += _autoContacts.size();
     for ( size_t i=0 ; i < _autoContacts.size() ; i++, count++ )
       _autoContacts[i]->updateGeometry();
     _autoContacts.clear();
@@ -259,6 +283,7 @@ namespace Anabatic {
     cdebug_log(145,0) << "_segmentInvalidateds.size(): " << _segmentInvalidateds.size() << endl;
 
     _segmentRevalidateds.clear();
+    _revalidateCounts[RevalidateSegments] += _segmentInvalidateds.size();
     std::sort( _segmentInvalidateds.begin(), _segmentInvalidateds.end()
              , AutoSegment::CompareByRevalidate() );
     for ( size_t i=0 ; i < _segmentInvalidateds.size() ; ++i, ++count ) {
@@ -274,6 +299,7 @@ namespace Anabatic {
     cdebug_log(145,0) << "AutoSegments/AutoContacts queued deletion." << endl;
     Flags flags = _anabatic->flags() & Flags::DestroyMask;
     _anabatic->flags() = Flags::DestroyMask;
+    _revalidateCounts[RevalidateDestroyeds] += _destroyedSegments.size();
     set<AutoSegment*>::iterator  isegment = _destroyedSegments.begin();
     for ( ; isegment != _destroyedSegments.end() ; isegment++ ) {
       AutoContact* source = (*isegment)->getAutoSource();
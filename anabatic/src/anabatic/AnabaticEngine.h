@@ -107,6 +107,7 @@ namespace Anabatic {
       inline       bool             isMixedPreRoute    () const;
       inline       bool             isFixed            () const;
       inline       bool             isExcluded         () const;
+      inline       bool             isRipupQueued      () const;
       inline       bool             isNoMoveUp         ( Segment* ) const;
       inline       Net*             getNet             () const;
       inline       NetRoutingState* getNetRoutingState () const;
@@ -121,6 +122,7 @@ namespace Anabatic {
       inline       void             setGlobalRouted    ( bool );
       inline       void             setGlobalFixed     ( bool );
       inline       void             setExcluded        ( bool );
+      inline       void             setRipupQueued     ( bool );
       inline       void             setRpCount         ( size_t );
       inline       void             setNoMoveUp        ( Segment* );
     private:                                     
@@ -145,6 +147,7 @@ namespace Anabatic {
   inline bool             NetData::isMixedPreRoute    () const { return (_state) ? _state->isMixedPreRoute() : false; }
   inline bool             NetData::isFixed            () const { return (_state) ? _state->isFixed        () : false; }
   inline bool             NetData::isExcluded         () const { return _flags & Flags::ExcludeRoute; }
+  inline bool             NetData::isRipupQueued      () const { return _flags & Flags::RipupQueued; }
   inline bool             NetData::isNoMoveUp         ( Segment* segment ) const { return (_noMoveUp.find(segment) != _noMoveUp.end()); }
   inline Net*             NetData::getNet             () const { return _net; }
   inline NetRoutingState* NetData::getNetRoutingState () const { return _state; }
@@ -158,6 +161,7 @@ namespace Anabatic {
   inline void             NetData::setGlobalRouted    ( bool state ) { _flags.set(Flags::GlobalRouted   ,state); }
   inline void             NetData::setGlobalFixed     ( bool state ) { _flags.set(Flags::GlobalFixed    ,state); }
   inline void             NetData::setExcluded        ( bool state ) { _flags.set(Flags::ExcludeRoute   ,state); }
+  inline void             NetData::setRipupQueued     ( bool state ) { _flags.set(Flags::RipupQueued    ,state); }
   inline void             NetData::setRpCount         ( size_t count ) { _rpCount=count; _update(); }
   inline void             NetData::setNoMoveUp        ( Segment* segment ) { _noMoveUp.insert(segment); }
 
@@ -241,6 +245,9 @@ namespace Anabatic {
       inline        int               incStamp                ();
                     Contact*          breakAt                 ( Segment*, GCell* );
                     void              ripup                   ( Segment*, Flags );
+      inline const  vector<NetData*>& getRipupNets            () const;
+      inline        void              addRipupNet             ( NetData* );
+      inline        void              clearRipupNets          ();
                     bool              unify                   ( Contact* );
     // Global routing related functions.                      
                     void              globalRoute             ();
@@ -343,6 +350,7 @@ namespace Anabatic {
              vector<GCell*>      _gcells;
              vector<Edge*>       _ovEdges;
              vector<NetData*>    _netOrdering;
+             vector<NetData*>    _ripupNets;
              NetDatas            _netDatas;
              CellViewer*         _viewer;
              Flags               _flags;
@@ -393,6 +401,7 @@ namespace Anabatic {
   inline       Net*              AnabaticEngine::getBlockageNet        () const { return _blockageNet; }
   inline const ChipTools&        AnabaticEngine::getChipTools          () const { return _chipTools; }
   inline const vector<NetData*>& AnabaticEngine::getNetOrdering        () const { return _netOrdering; }
+  inline const vector<NetData*>& AnabaticEngine::getRipupNets          () const { return _ripupNets; }
   inline       void              AnabaticEngine::setGlobalThreshold    ( DbU::Unit threshold ) { _configuration->setGlobalThreshold(threshold); }
   inline const NetDatas&         AnabaticEngine::getNetDatas           () const { return _netDatas; }
   inline       void              AnabaticEngine::_updateLookup         ( GCell* gcell ) { _matrix.updateLookup(gcell); }
@@ -400,6 +409,19 @@ namespace Anabatic {
   inline       void              AnabaticEngine::_updateGContacts      ( Flags flags ) { for ( GCell* gcell : getGCells() ) gcell->updateGContacts(flags); }
   inline       bool              AnabaticEngine::_inDestroy            () const { return _flags & Flags::DestroyMask; }
   
+  inline void  AnabaticEngine::addRipupNet ( NetData* data )
+  {
+    if (data->isRipupQueued()) return;
+    data->setRipupQueued( true );
+    _ripupNets.push_back( data );
+  }
+
+  inline void  AnabaticEngine::clearRipupNets ()
+  {
+    for ( NetData* data : _ripupNets ) data->setRipupQueued( false );
+    _ripupNets.clear();
+  }
+
   inline void  AnabaticEngine::_add ( GCell* gcell )
   {
     _gcells.push_back( gcell );
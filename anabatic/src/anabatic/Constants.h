@@ -57,6 +57,7 @@ namespace Anabatic {
       static const BaseFlags  GlobalRouted        ; // = (1 <<  7);
       static const BaseFlags  DetailRouted        ; // = (1 <<  8);
       static const BaseFlags  ExcludeRoute        ; // = (1 <<  9);
+      static const BaseFlags  RipupQueued         ; // = (1 << 10);
     // Masks.                                      
       static const BaseFlags  WestSide            ; // = Horizontal|Target;
       static const BaseFlags  EastSide            ; // = Horizontal|Source;
@@ -16,6 +16,7 @@
 
 #pragma  once
 #include <set>
+#include <limits>
 #include <iomanip>
 #include "hurricane/Observer.h"
 namespace Hurricane {
@@ -34,6 +35,7 @@ namespace Anabatic {
   using Hurricane::RoutingPad;
   using Hurricane::Plug;
   class AnabaticEngine;
+  class PriorityQueue;
 
 
 // -------------------------------------------------------------------
@@ -168,6 +170,7 @@ namespace Anabatic {
 // Class  :  "Anabatic::Vertex".
 
   class Vertex {
+      friend class PriorityQueue;
     public:
       static inline std::string  getValueString ( DbU::Unit );
     public:
@@ -217,6 +220,7 @@ namespace Anabatic {
              inline  int             getConnexId       () const;
              inline  int             getDegree         () const;
              inline  int             getRpCount        () const;
+             inline  bool            isQueued          () const;
                      Edge*           getFrom           () const;
              inline  Vertex*         getPredecessor    () const;
              inline  Vertex*         getNeighbor       ( Edge* ) const;
@@ -311,6 +315,9 @@ namespace Anabatic {
       Edge*                _from;
       uint32_t             _flags;
       GRAData*             _adata;
+      size_t               _qindex;
+      size_t               _qorder;
+      DbU::Unit            _qestimate;
   }; 
 
 
@@ -327,6 +334,9 @@ namespace Anabatic {
     , _from    (NULL)
     , _flags   (NoRestriction)
     , _adata   (NULL)
+    , _qindex  (std::numeric_limits<size_t>::max())
+    , _qorder  (0)
+    , _qestimate(0)
   {
     gcell->setObserver( GCell::Observable::Vertex, &_observer );
   }
@@ -350,6 +360,7 @@ namespace Anabatic {
   inline int             Vertex::getBranchId    () const { return hasValidStamp() ? _branchId :  0; }
   inline int             Vertex::getDegree      () const { return hasValidStamp() ? _degree   :  0; }
   inline int             Vertex::getRpCount     () const { return hasValidStamp() ? _rpCount  :  0; }
+  inline bool            Vertex::isQueued       () const { return _qindex != std::numeric_limits<size_t>::max(); }
 //inline Edge*           Vertex::getFrom        () const { return _from; }
   inline void            Vertex::setDistance    ( DbU::Unit distance ) { _distance=distance; }
   inline void            Vertex::setFrom        ( Edge* from ) { _from=from; }
@@ -419,8 +430,21 @@ namespace Anabatic {
 
 // -------------------------------------------------------------------
 // Class  :  "Anabatic::PriorityQueue".
+//
+// Indexed d-ary min-heap. The position of each queued Vertex is kept
+// inside the Vertex itself (_qindex), so erase() and the re-ordering
+// of an already queued Vertex whose distance has changed (decrease-key)
+// are done in O(log n) without searching. Vertexes of equal keys are
+// popped in insertion order (_qorder), like with the former multiset.
+//
+// When an estimate is set (A* mode), the key of a Vertex is its distance
+// plus a lower bound of the remaining distance to the target area,
+// computed once when the Vertex is pushed (_qestimate).
 
   class PriorityQueue {
+    public:
+      static const size_t  Arity = 4;
+      static const size_t  npos  = std::numeric_limits<size_t>::max();
     public:
       inline                PriorityQueue ();
       inline               ~PriorityQueue ();
@@ -435,49 +459,113 @@ namespace Anabatic {
       inline        void    setAttractor  ( const Point& );
       inline  const Point&  getAttractor  () const;
       inline        bool    hasAttractor  () const;
+      inline        void    setEstimate   ( const Box& targetArea, float scaling );
+      inline        bool    hasEstimate   () const;
     private:
-      class CompareByDistance {
-        public:
-                 inline      CompareByDistance ();
-                        bool operator()        ( const Vertex* lhs, const Vertex* rhs );
-          static inline void setQueue          ( PriorityQueue* );
-        private:
-          static PriorityQueue* _pqueue;
-      };
+      inline        DbU::Unit _getKey     ( const Vertex* ) const;
+                    bool    _isLess       ( const Vertex* lhs, const Vertex* rhs ) const;
+      inline        void    _place        ( Vertex*, size_t index );
+      inline        void    _remove       ( size_t index );
+                    void    _siftUp       ( size_t index );
+                    void    _siftDown     ( size_t index );
     private:
-      bool                                 _hasAttractor;
-      Point                                _attractor;
-      multiset<Vertex*,CompareByDistance>  _queue;
+      bool             _hasAttractor;
+      Point            _attractor;
+      bool             _hasEstimate;
+      Box              _targetArea;
+      float            _estimateScaling;
+      vector<Vertex*>  _heap;
+      size_t           _order;
   };
 
 
-  inline      PriorityQueue::CompareByDistance::CompareByDistance () { }
-
-  inline void PriorityQueue::CompareByDistance::setQueue ( PriorityQueue* pqueue ) { _pqueue = pqueue; }
+  inline               PriorityQueue::PriorityQueue  ()
+    : _hasAttractor   (false)
+    , _attractor      ()
+    , _hasEstimate    (false)
+    , _targetArea     ()
+    , _estimateScaling(1.0)
+    , _heap           ()
+    , _order          (0)
+  { }
 
 
-  inline               PriorityQueue::PriorityQueue  () : _hasAttractor(false), _attractor(), _queue() { PriorityQueue::CompareByDistance::setQueue(this); }
   inline               PriorityQueue::~PriorityQueue () { }
-  inline       bool    PriorityQueue::empty          () const { return _queue.empty(); }
-  inline       size_t  PriorityQueue::size           () const { return _queue.size(); }
-  inline       void    PriorityQueue::push           ( Vertex* v ) { _queue.insert(v); }
-  inline       Vertex* PriorityQueue::top            () { return _queue.empty() ? NULL : *_queue.begin(); }
-  inline       void    PriorityQueue::clear          () { _queue.clear(); _hasAttractor=false; }
+  inline       bool    PriorityQueue::empty          () const { return _heap.empty(); }
+  inline       size_t  PriorityQueue::size           () const { return _heap.size(); }
+  inline       Vertex* PriorityQueue::top            () { return _heap.empty() ? NULL : _heap[0]; }
   inline       void    PriorityQueue::setAttractor   ( const Point& p ) { _attractor=p;  _hasAttractor=true; }
   inline       bool    PriorityQueue::hasAttractor   () const { return _hasAttractor; }
   inline const Point&  PriorityQueue::getAttractor   () const { return _attractor; }
+  inline       bool    PriorityQueue::hasEstimate    () const { return _hasEstimate; }
+
+  inline void  PriorityQueue::setEstimate ( const Box& targetArea, float scaling )
+  {
+    _targetArea      = targetArea;
+    _estimateScaling = scaling;
+    _hasEstimate     = not targetArea.isEmpty();
+  }
+
+  inline DbU::Unit  PriorityQueue::_getKey ( const Vertex* v ) const
+  {
+    DbU::Unit distance = v->getDistance();
+    if (distance >= Vertex::unreachable) return distance;
+    return distance + v->_qestimate;
+  }
+
+  inline void  PriorityQueue::_place ( Vertex* v, size_t index )
+  {
+    _heap[index] = v;
+    v->_qindex   = index;
+  }
+
+  inline void  PriorityQueue::_remove ( size_t index )
+  {
+    _heap[index]->_qindex = npos;
+
+    Vertex* last = _heap.back();
+    _heap.pop_back();
+    if (index == _heap.size()) return;
+
+    _place( last, index );
+    _siftUp  ( index );
+    _siftDown( last->_qindex );
+  }
+
+  inline void  PriorityQueue::push ( Vertex* v )
+  {
+  // Pushing an already queued vertex only re-orders it (decrease-key).
+  // It is then put after the vertexes of same key, as a re-insertion would.
+    v->_qorder    = _order++;
+    v->_qestimate = 0;
+    if (_hasEstimate)
+      v->_qestimate = (DbU::Unit)( _estimateScaling * (float)_targetArea.manhattanDistance(v->getCenter()) );
+    if (v->isQueued()) {
+      _siftUp  ( v->_qindex );
+      _siftDown( v->_qindex );
+      return;
+    }
+    _heap.push_back( v );
+    _place ( v, _heap.size()-1 );
+    _siftUp( v->_qindex );
+  }
 
   inline void  PriorityQueue::pop ()
   {
-    cdebug_log(112,0) << "Pop: (size:" << _queue.size() << ") " << *_queue.begin() << std::endl;
-    _queue.erase(_queue.begin());
+    cdebug_log(112,0) << "Pop: (size:" << _heap.size() << ") " << _heap[0] << std::endl;
+    _remove( 0 );
   }
 
   inline void  PriorityQueue::erase ( Vertex* v )
+  { if (v->isQueued()) _remove( v->_qindex ); }
+
+  inline void  PriorityQueue::clear ()
   {
-    for ( auto ivertex = _queue.begin() ; ivertex != _queue.end() ; ++ivertex ) {
-      if (*ivertex == v) { _queue.erase( ivertex ); break; }
-    }
+    for ( Vertex* v : _heap ) v->_qindex = npos;
+    _heap.clear();
+    _order        = 0;
+    _hasAttractor = false;
+    _hasEstimate  = false;
   }
 
   inline void  PriorityQueue::dump () const
@@ -485,7 +573,7 @@ namespace Anabatic {
     if (cdebug.enabled(112)) {
       cdebug_log(112,1) << "PriorityQueue::dump() size:" << size() << std::endl;
       size_t order = 0;
-      for ( Vertex* v : _queue )
+      for ( Vertex* v : _heap )
         cdebug_log(112,0) << "[" << tsetw(3) << order++ << "] " << v << std::endl;
       cdebug_tabw(112,-1);
     }
@@ -504,6 +592,7 @@ namespace Anabatic {
                     , Standart   = (1<<0)
                     , Monotonic  = (1<<1)
                     , AxisTarget = (1<<2)
+                    , AStar      = (1<<3)
                     };
         public:
           inline               Mode         ( Flag flags=NoMode );
@@ -524,9 +613,12 @@ namespace Anabatic {
       inline       bool       isTargetVertex           ( Vertex* ) const;
                    DbU::Unit  getAntennaGateMaxWL      () const;
       inline       DbU::Unit  getSearchAreaHalo        () const;
+      inline       float      getEstimateScaling       () const;
+      inline       size_t     getExpandedCount         () const;
       template<typename DistanceT>                     
       inline       DistanceT* setDistance              ( DistanceT );
       inline       void       setSearchAreaHalo        ( DbU::Unit );
+      inline       void       setEstimateScaling       ( float );
                    void       load                     ( Net* net ); 
                    void       loadFixedGlobal          ( Net* net ); 
                    void       run                      ( Mode mode=Mode::Standart );
@@ -537,6 +629,7 @@ namespace Anabatic {
       static       DbU::Unit  _distance                ( const Vertex*, const Vertex*, const Edge* );
                    Point      _getPonderedPoint        () const;
                    void       _cleanup                 ();
+                   void       _updateEstimate          ();
                    bool       _propagate               ( Flags enabledSides );
                    void       _traceback               ( Vertex* );
                    void       _materialize             ();
@@ -577,6 +670,8 @@ namespace Anabatic {
       int              _connectedsId;
       PriorityQueue    _queue;
       Flags            _flags;
+      float            _estimateScaling;
+      size_t           _expandeds;
   };
 
 
@@ -589,6 +684,9 @@ namespace Anabatic {
   inline Net*       Dijkstra::getNet            () const { return _net; }
   inline DbU::Unit  Dijkstra::getSearchAreaHalo () const { return _searchAreaHalo; }
   inline void       Dijkstra::setSearchAreaHalo ( DbU::Unit halo ) { _searchAreaHalo = halo; }
+  inline float      Dijkstra::getEstimateScaling () const { return _estimateScaling; }
+  inline size_t     Dijkstra::getExpandedCount   () const { return _expandeds; }
+  inline void       Dijkstra::setEstimateScaling ( float scaling ) { _estimateScaling = scaling; }
 
   template<typename DistanceT>
   inline DistanceT* Dijkstra::setDistance       ( DistanceT cb ) { _distanceCb = cb; return _distanceCb.target<DistanceT>(); }
@@ -69,6 +69,15 @@ namespace Anabatic {
 // Class  :  "Anabatic::Session".
 
   class Session {
+    public:
+      enum RevalidateCounter { RevalidateCalls    = 0
+                             , RevalidateEmpties
+                             , RevalidateNets
+                             , RevalidateContacts
+                             , RevalidateSegments
+                             , RevalidateDestroyeds
+                             , RevalidateCounterSize
+                             };
     public:
     // Static Methods.
       static  inline bool                              isOpen                ();
@@ -141,6 +150,8 @@ namespace Anabatic {
       static  inline const set<AutoSegment*>&          getDestroyeds         (); 
       static  inline const vector<AutoSegment*>&       getDoglegs            (); 
       static  inline const set<Net*,DBo::CompareById>& getNetsModificateds   (); 
+      static  inline size_t                            getRevalidateCount    ( RevalidateCounter );
+      static         void                              resetRevalidateCounts ();
       static         void                              close                 ();
       static         void                              setAnabaticFlags      ( Flags );
       static  inline void                              dogleg                ( AutoSegment* );
@@ -182,6 +193,7 @@ namespace Anabatic {
                                    
     protected:                     
       static Session*                    _session;
+      static size_t                      _revalidateCounts[RevalidateCounterSize];
              AnabaticEngine*             _anabatic;
              Technology*                 _technology;
              CellGauge*                  _cellGauge;
@@ -225,6 +237,7 @@ namespace Anabatic {
   inline const set<AutoSegment*>&          Session::getDestroyeds        () { return get("getDestroyeds()")->_destroyedSegments; }
   inline const vector<AutoSegment*>&       Session::getDoglegs           () { return get("getDoglegs()")->_doglegs; }
   inline const set<Net*,DBo::CompareById>& Session::getNetsModificateds  () { return get("getNetsModificateds()")->_netRevalidateds; }
+  inline size_t                            Session::getRevalidateCount   ( RevalidateCounter counter ) { return _revalidateCounts[counter]; }
   inline void                              Session::doglegReset          () { return get("doglegReset()")->_doglegReset (); }
   inline void                              Session::invalidate           ( Net* net ) { return get("invalidate(Net*)")->_invalidate(net); }
   inline void                              Session::invalidate           ( AutoContact* autoContact ) { return get("invalidate(AutoContact*)")->_invalidate(autoContact); }
@@ -5,20 +5,39 @@
 
 namespace coloquinte{
 
+namespace{
+// Same position as the pins returned by get_pins_1D/get_pins_2D
+inline point<int_t> get_pin_position(netlist const & circuit, placement_t const & pl, netlist::pin_t const p){
+    point<int_t> offs;
+    offs.x = pl.orientations_[p.cell_ind].x ? p.offset.x : circuit.get_cell(p.cell_ind).size.x - p.offset.x;
+    offs.y = pl.orientations_[p.cell_ind].y ? p.offset.y : circuit.get_cell(p.cell_ind).size.y - p.offset.y;
+    return offs + pl.positions_[p.cell_ind];
+}
+} // End anonymous namespace
+
 std::int64_t get_HPWL_length(netlist const & circuit, placement_t const & pl, index_t net_ind){
     if(circuit.get_net(net_ind).pin_cnt <= 1) return 0;
 
-    auto pins = get_pins_1D(circuit, pl, net_ind);
-    auto minmaxX = std::minmax_element(pins.x.begin(), pins.x.end()), minmaxY = std::minmax_element(pins.y.begin(), pins.y.end());
-    return ((minmaxX.second->pos - minmaxX.first->pos) + (minmaxY.second->pos - minmaxY.first->pos));
+    // Min/max reduction directly on the pin positions: no temporary pin vectors
+    auto it = circuit.get_net(net_ind).begin();
+    point<int_t> pos = get_pin_position(circuit, pl, *it);
+    int_t min_x = pos.x, max_x = pos.x, min_y = pos.y, max_y = pos.y;
+    for(++it; it != circuit.get_net(net_ind).end(); ++it){
+        pos = get_pin_position(circuit, pl, *it);
+        min_x = std::min(min_x, pos.x);
+        max_x = std::max(max_x, pos.x);
+        min_y = std::min(min_y, pos.y);
+        max_y = std::max(max_y, pos.y);
+    }
+    return (static_cast<std::int64_t>(max_x) - min_x) + (static_cast<std::int64_t>(max_y) - min_y);
 }
 
 std::int64_t get_RSMT_length(netlist const & circuit, placement_t const & pl, index_t net_ind){
     if(circuit.get_net(net_ind).pin_cnt <= 1) return 0;
-    auto pins = get_pins_2D(circuit, pl, net_ind);
     std::vector<point<int_t> > points;
-    for(pin_2D const p : pins){
-        points.push_back(p.pos);
+    points.reserve(circuit.get_net(net_ind).pin_cnt);
+    for(auto p : circuit.get_net(net_ind)){
+        points.push_back(get_pin_position(circuit, pl, p));
     }
     return RSMT_length(points, 8);
 }
@@ -245,8 +264,10 @@ point<linear_system> get_RSMT_linear_system(netlist const & circuit, placement_t
 }
 
 
+// The nets are independent and the placement is only read: sum them in parallel
 std::int64_t get_HPWL_wirelength(netlist const & circuit, placement_t const & pl){
     std::int64_t sum = 0;
+    #pragma omp parallel for schedule(static) reduction(+:sum)
     for(index_t i=0; i<circuit.net_cnt(); ++i){
         sum += get_HPWL_length(circuit, pl, i);
     }
@@ -269,6 +290,8 @@ std::int64_t get_MST_wirelength(netlist const & circuit, placement_t const & pl)
 
 std::int64_t get_RSMT_wirelength(netlist const & circuit, placement_t const & pl){
     std::int64_t sum = 0;
+    // Dynamic schedule: the cost of a net grows quickly with its degree
+    #pragma omp parallel for schedule(dynamic, 256) reduction(+:sum)
     for(index_t i=0; i<circuit.net_cnt(); ++i){
         sum += get_RSMT_length(circuit, pl, i);
     }
@@ -286,7 +309,10 @@ void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear
         x_guess[i] = static_cast<float_t>(pl.positions_[i].x);
         y_guess[i] = static_cast<float_t>(pl.positions_[i].y);
     }
-    #pragma omp parallel sections num_threads(2)
+    // Large systems are solved with parallel loops, one direction after the other;
+    // the small ones are serial internally and are solved concurrently instead
+    bool const small_systems = L.x.size() <= CG_block_size and L.y.size() <= CG_block_size;
+    #pragma omp parallel sections num_threads(2) if(small_systems)
     {
     #pragma omp section
     x_sol = L.x.solve_CG(x_guess, nbr_iter);
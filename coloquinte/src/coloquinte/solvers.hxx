@@ -24,6 +24,9 @@ struct matrix_triplet{
     bool operator<(matrix_triplet const o){ return r_ < o.r_ || (r_ == o.r_ && c_ < o.c_); }
 };
 
+// solve_CG only uses parallel loops for systems of more than CG_block_size rows
+index_t const CG_block_size = 4096;
+
 class linear_system{
     std::vector<matrix_triplet> matrix_;
     std::vector<float_t> target_;
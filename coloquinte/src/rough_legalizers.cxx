@@ -304,8 +304,10 @@ void region_distribution::x_bipartition(){
     index_t old_y_regions_cnt = y_regions_cnt();
     x_regions_cnt_ *= 2;
 
-    for(index_t x=0; x < old_x_regions_cnt; ++x){
-        for(index_t y=0; y < old_y_regions_cnt; ++y){
+    // Each old region is split into its own pair of new regions: the iterations are independent
+    #pragma omp parallel for
+    for(index_t y=0; y < old_y_regions_cnt; ++y){
+        for(index_t x=0; x < old_x_regions_cnt; ++x){
             index_t i = y * old_x_regions_cnt + x;
             old_placement_regions[i].distribute_cells(get_region(2*x, y), get_region(2*x+1, y));
         }
@@ -320,6 +322,7 @@ void region_distribution::y_bipartition(){
     index_t old_y_regions_cnt = y_regions_cnt();
     y_regions_cnt_ *= 2;
 
+    #pragma omp parallel for
     for(index_t x=0; x < old_x_regions_cnt; ++x){
         for(index_t y=0; y < old_y_regions_cnt; ++y){
             index_t i = y * old_x_regions_cnt + x;
@@ -494,6 +497,7 @@ void region_distribution::multipartition(index_t x_width, index_t y_width){
     x_regions_cnt_ *= x_width;
     y_regions_cnt_ *= y_width;
 
+    #pragma omp parallel for
     for(index_t x=0; x < old_x_regions_cnt; ++x){
         for(index_t y=0; y < old_y_regions_cnt; ++y){
 
@@ -612,11 +616,18 @@ void region_distribution::redo_multipartitions(index_t x_width, index_t y_width)
         }
     };
 
-    for(index_t y=0; y < y_regions_cnt(); y+=y_width){
+    // Bands of y_width rows are disjoint: optimize all the shifted bands, then all the aligned ones
+    index_t bands_cnt = (y_regions_cnt() + y_width - 1) / y_width;
+    #pragma omp parallel for
+    for(index_t b=0; b < bands_cnt; ++b){
+        index_t y = b*y_width;
         if(y+y_width < y_regions_cnt()){
             optimize_on_y(y+y_width/2);
         }
-        optimize_on_y(y);
+    }
+    #pragma omp parallel for
+    for(index_t b=0; b < bands_cnt; ++b){
+        optimize_on_y(b*y_width);
     }
 }
 
@@ -795,14 +806,26 @@ void region_distribution::redo_diag_partitions(index_t len){
         }
     };
 
-    for(index_t y=y_regions_cnt()-2; y >= 1; --y)
-        reoptimize_rdiag(0, y);
-    for(index_t x=0; x+1<x_regions_cnt(); ++x)
-        reoptimize_rdiag(x, 0);
-    for(index_t y=1; y+1<y_regions_cnt(); ++y)
-        reoptimize_ldiag(0, y);
-    for(index_t x=0; x+1<x_regions_cnt(); ++x)
-        reoptimize_ldiag(x, y_regions_cnt()-1);
+    // Each call works on a single diagonal, and the diagonals are disjoint:
+    // the result is the same as the sequential one
+    index_t rdiag_y_cnt = y_regions_cnt()-2;
+    index_t rdiag_cnt   = rdiag_y_cnt + x_regions_cnt()-1;
+    #pragma omp parallel for
+    for(index_t i=0; i < rdiag_cnt; ++i){
+        if(i < rdiag_y_cnt)
+            reoptimize_rdiag(0, y_regions_cnt()-2-i);
+        else
+            reoptimize_rdiag(i-rdiag_y_cnt, 0);
+    }
+    index_t ldiag_y_cnt = y_regions_cnt()-2;
+    index_t ldiag_cnt   = ldiag_y_cnt + x_regions_cnt()-1;
+    #pragma omp parallel for
+    for(index_t i=0; i < ldiag_cnt; ++i){
+        if(i < ldiag_y_cnt)
+            reoptimize_ldiag(0, i+1);
+        else
+            reoptimize_ldiag(i-ldiag_y_cnt, y_regions_cnt()-1);
+    }
 }
 
 region_distribution::region_distribution(
@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <cmath>
 #include <limits>
+#include <algorithm>
+#include <utility>
 
 namespace coloquinte{
 namespace gp{
@@ -40,14 +42,27 @@ linear_system linear_system::operator+(linear_system const & o) const{
 }
 
 
+namespace{
+
+// The parallel loops of the solver work on fixed-size blocks of rows.
+// Reductions are done per block and summed in block order, so that the result
+// doesn't depend on the number of threads and the placement stays reproducible
+std::uint32_t const block_size = CG_block_size;
+
+inline std::uint32_t block_cnt(std::uint32_t n){ return (n + block_size - 1) / block_size; }
+inline std::uint32_t block_begin(std::uint32_t b){ return b * block_size; }
+inline std::uint32_t block_end(std::uint32_t b, std::uint32_t n){ return std::min(n, (b+1) * block_size); }
+
+} // End anonymous namespace
+
 // The classical compressed sparse row storage
 struct csr_matrix{
     std::vector<std::uint32_t> row_limits, col_indexes;
     std::vector<float> values, diag;
 
-    std::vector<float> mul(std::vector<float> const & x) const;
-    std::vector<float> solve_CG(std::vector<float> const & goal, std::vector<float> guess, std::uint32_t min_iter, std::uint32_t max_iter, float tol) const;
-    csr_matrix(std::vector<std::uint32_t> const & row_l, std::vector<std::uint32_t> const & col_i, std::vector<float> const & vals, std::vector<float> const D) : row_limits(row_l), col_indexes(col_i), values(vals), diag(D){
+    std::uint32_t size() const{ return diag.size(); }
+    void mul(std::vector<float> const & x, std::vector<float> & res) const;
+    csr_matrix(std::vector<std::uint32_t> row_l, std::vector<std::uint32_t> col_i, std::vector<float> vals, std::vector<float> D) : row_limits(std::move(row_l)), col_indexes(std::move(col_i)), values(std::move(vals)), diag(std::move(D)){
         assert(values.size() == col_indexes.size());
         assert(diag.size()+1 == row_limits.size());
     }
@@ -59,10 +74,10 @@ struct ellpack_matrix{
     std::vector<std::uint32_t> row_limits, col_indexes;
     std::vector<float> values, diag;
 
-    std::vector<float> mul(std::vector<float> const & x) const;
-    std::vector<float> solve_CG(std::vector<float> goal, std::vector<float> guess, std::uint32_t min_iter, std::uint32_t max_iter, float tol) const;
+    std::uint32_t size() const{ return diag.size(); }
+    void mul(std::vector<float> const & x, std::vector<float> & res) const;
 
-    ellpack_matrix(std::vector<std::uint32_t> const & row_l, std::vector<std::uint32_t> const & col_i, std::vector<float> const & vals, std::vector<float> const D) : row_limits(row_l), col_indexes(col_i), values(vals), diag(D){
+    ellpack_matrix(std::vector<std::uint32_t> row_l, std::vector<std::uint32_t> col_i, std::vector<float> vals, std::vector<float> D) : row_limits(std::move(row_l)), col_indexes(std::move(col_i)), values(std::move(vals)), diag(std::move(D)){
         assert(values.size() == col_indexes.size());
         assert(diag.size() % unroll_len == 0);
         assert((row_limits.size()-1) * unroll_len == diag.size() );
@@ -78,12 +93,12 @@ class doublet_matrix{
     std::vector<matrix_doublet> doublets;
     std::uint32_t size;
 
-    void get_compressed(std::vector<std::uint32_t> & limits, std::vector<matrix_doublet> & elements, std::vector<float> & diag) const;
+    void get_compressed(std::vector<std::uint32_t> & limits, std::vector<matrix_doublet> & elements, std::vector<float> & diag);
     public:
     doublet_matrix(std::vector<matrix_triplet> const & triplets, std::uint32_t size);
-    csr_matrix get_compressed_matrix() const;
+    csr_matrix get_compressed_matrix();
     template<std::uint32_t unroll_len>
-    ellpack_matrix<unroll_len> get_ellpack_matrix() const;
+    ellpack_matrix<unroll_len> get_ellpack_matrix();
 };
 
 doublet_matrix::doublet_matrix(std::vector<matrix_triplet> const & triplets, std::uint32_t n) : size(n){
@@ -113,11 +128,13 @@ doublet_matrix::doublet_matrix(std::vector<matrix_triplet> const & triplets, std
     }
 }
 
-void doublet_matrix::get_compressed(std::vector<std::uint32_t> & sizes, std::vector<matrix_doublet> & elements, std::vector<float> & diag) const{
+// Sorts the rows in place: the doublet matrix is only a temporary for the conversion
+void doublet_matrix::get_compressed(std::vector<std::uint32_t> & sizes, std::vector<matrix_doublet> & elements, std::vector<float> & diag){
     assert(size+1 == row_limits.size());
     sizes.resize(size);
     diag.resize(size, 0.0);
-    std::vector<matrix_doublet> tmp_doublets = doublets;
+    elements.reserve(doublets.size());
+    std::vector<matrix_doublet> & tmp_doublets = doublets;
 
     for(uint32_t i=0; i<size; ++i){
         // Sort the elements in the row
@@ -151,7 +168,7 @@ void doublet_matrix::get_compressed(std::vector<std::uint32_t> & sizes, std::vec
     }
 }
 
-csr_matrix doublet_matrix::get_compressed_matrix() const{
+csr_matrix doublet_matrix::get_compressed_matrix(){
     std::vector<matrix_doublet> tmp_doublets;
     std::vector<std::uint32_t> sizes;
     std::vector<float> diag;
@@ -172,11 +189,11 @@ csr_matrix doublet_matrix::get_compressed_matrix() const{
         values[i] = tmp_doublets[i].val_;
     }
 
-    return csr_matrix(new_row_limits, col_indices, values, diag);
+    return csr_matrix(std::move(new_row_limits), std::move(col_indices), std::move(values), std::move(diag));
 }
 
 template<std::uint32_t unroll_len>
-ellpack_matrix<unroll_len> doublet_matrix::get_ellpack_matrix() const{
+ellpack_matrix<unroll_len> doublet_matrix::get_ellpack_matrix(){
     std::vector<matrix_doublet> tmp_doublets;
     std::vector<std::uint32_t> sizes;
     std::vector<float> diag;
@@ -216,84 +233,114 @@ ellpack_matrix<unroll_len> doublet_matrix::get_ellpack_matrix() const{
         }
     }
     
-    return ellpack_matrix<unroll_len>(new_row_limits, col_indices, values, diag);
+    return ellpack_matrix<unroll_len>(std::move(new_row_limits), std::move(col_indices), std::move(values), std::move(diag));
 }
 
-std::vector<float> csr_matrix::mul(std::vector<float> const & x) const{
-    std::vector<float> res(x.size());
-    assert(x.size() == diag.size());
-    for(std::uint32_t i=0; i<diag.size(); ++i){
-        res[i] = diag[i] * x[i];
+void csr_matrix::mul(std::vector<float> const & x, std::vector<float> & res) const{
+    std::uint32_t n = diag.size();
+    assert(x.size() == n);
+    assert(res.size() == n);
+    #pragma omp parallel for schedule(static) if(n > block_size)
+    for(std::uint32_t i=0; i<n; ++i){
+        float cur = diag[i] * x[i];
         for(std::uint32_t j=row_limits[i]; j<row_limits[i+1]; ++j){
-            res[i] += values[j] * x[col_indexes[j]];
+            cur += values[j] * x[col_indexes[j]];
         }
+        res[i] = cur;
     }
-    return res;
 }
 
 template<std::uint32_t unroll_len>
-std::vector<float> ellpack_matrix<unroll_len>::mul(std::vector<float> const & x) const{
-    std::vector<float> res(x.size());
+void ellpack_matrix<unroll_len>::mul(std::vector<float> const & x, std::vector<float> & res) const{
     assert(x.size() % unroll_len == 0);
     assert(x.size() == diag.size());
-    for(std::uint32_t i=0; i+1<row_limits.size(); ++i){
+    assert(res.size() == diag.size());
+    std::uint32_t groups = row_limits.size()-1;
+    #pragma omp parallel for schedule(static) if(groups * unroll_len > block_size)
+    for(std::uint32_t i=0; i<groups; ++i){
         float cur[unroll_len];
-        for(int k=0; k<unroll_len; ++k){
+        for(std::uint32_t k=0; k<unroll_len; ++k){
             cur[k] = diag[unroll_len*i+k] * x[unroll_len*i+k];
         }
         for(std::uint32_t j=row_limits[i]; j<row_limits[i+1]; ++j){
-            for(int k=0; k<unroll_len; ++k){
+            // Consecutive rows are interleaved: this loop is vectorizable
+            for(std::uint32_t k=0; k<unroll_len; ++k){
                 cur[k] += values[unroll_len*j+k] * x[col_indexes[unroll_len*j+k]];
             }
         }
-        for(int k=0; k<unroll_len; ++k){
+        for(std::uint32_t k=0; k<unroll_len; ++k){
             res[unroll_len*i+k] = cur[k];
         }
     }
-    return res;
 }
 
 template<std::uint32_t unroll_len>
-float dot_prod(std::vector<float> const & a, std::vector<float> const & b){
-    assert(a.size() == b.size());
+float dot_prod(float const * a, float const * b, std::uint32_t n){
     float vals[unroll_len];
-    for(int j=0; j<unroll_len; ++j) vals[j] = 0.0;
-    for(std::uint32_t i=0; i<a.size() / unroll_len; ++i){
-        for(int j=0; j<unroll_len; ++j){
+    for(std::uint32_t j=0; j<unroll_len; ++j) vals[j] = 0.0;
+    for(std::uint32_t i=0; i<n / unroll_len; ++i){
+        for(std::uint32_t j=0; j<unroll_len; ++j){
             vals[j] += a[unroll_len*i + j] * b[unroll_len*i + j];
         }
     }
     float res = 0.0;
-    for(int j=0; j<unroll_len; ++j) res += vals[j];
-    for(int i = unroll_len*(a.size() / unroll_len); i< a.size(); ++i){
+    for(std::uint32_t j=0; j<unroll_len; ++j) res += vals[j];
+    for(std::uint32_t i = unroll_len*(n / unroll_len); i< n; ++i){
         res += a[i] * b[i];
     }
     return res;
 }
 
-std::vector<float> csr_matrix::solve_CG(std::vector<float> const & goal, std::vector<float> x, std::uint32_t min_iter, std::uint32_t max_iter, float tol_ratio) const{
-    std::uint32_t n = diag.size();
-    assert(goal.size() == n);
-    assert(x.size() == n);
-    std::vector<float> r, p(n), z(n), mul_res, preconditioner(n);
-    r = mul(x);
-    for(uint32_t i=0; i<n; ++i){
+float sum_blocks(std::vector<float> const & partials){
+    float res = 0.0;
+    for(float p : partials) res += p;
+    return res;
+}
+
+float dot_prod(std::vector<float> const & a, std::vector<float> const & b, std::vector<float> & partials){
+    assert(a.size() == b.size());
+    std::uint32_t n = a.size();
+    #pragma omp parallel for schedule(static) if(n > block_size)
+    for(std::uint32_t bl=0; bl<partials.size(); ++bl){
+        std::uint32_t begin = block_begin(bl), end = block_end(bl, n);
+        partials[bl] = dot_prod<16>(a.data() + begin, b.data() + begin, end - begin);
+    }
+    return sum_blocks(partials);
+}
+
+/*
+ * Jacobi preconditioned conjugate gradient
+ *
+ * All work vectors are allocated once, the matrix product, the vector updates and the dot products are parallelized over blocks of rows.
+ * The update of the solution and residual is fused with the computation of the next dot product
+ */
+template<typename matrix>
+std::vector<float> solve_CG(matrix const & mat, std::vector<float> goal, std::vector<float> x, std::uint32_t min_iter, std::uint32_t max_iter, float tol_ratio){
+    std::uint32_t n = mat.size();
+    std::uint32_t old_n = x.size();
+    assert(goal.size() == x.size());
+    x.resize(n, 0.0);
+    goal.resize(n, 0.0);
+
+    std::vector<float> r(n), p(n), z(n), mul_res(n), preconditioner(n), partials(block_cnt(n));
+    mat.mul(x, r);
+    for(std::uint32_t i=0; i<n; ++i){
         r[i] = goal[i] - r[i];
-        preconditioner[i] = 1.0/diag[i];
+        preconditioner[i] = 1.0/mat.diag[i];
         assert(std::isfinite(preconditioner[i]));
         z[i] = preconditioner[i] * r[i];
         p[i] = z[i];
     }
 
-    float cross_norm = dot_prod<16>(r, z);
+    float cross_norm = dot_prod(r, z, partials);
     assert(std::isfinite(cross_norm));
     float_t const epsilon = std::numeric_limits<float_t>::min();
 
     float start_norm = cross_norm;
-    for(uint32_t k=0; k < max_iter; ++k){
-        mul_res = mul(p);
+    for(std::uint32_t k=0; k < max_iter; ++k){
+        mat.mul(p, mul_res);
 
-        float_t pr_prod = dot_prod<16>(p, mul_res);
+        float_t pr_prod = dot_prod(p, mul_res, partials);
         float_t alpha = cross_norm / pr_prod;
 
         if(
@@ -303,13 +350,18 @@ std::vector<float> csr_matrix::solve_CG(std::vector<float> const & goal, std::ve
             break;
         }
 
-        // Update the result
-        for(uint32_t i=0; i<n; ++i){
-            x[i] = x[i] + alpha * p[i];
-            r[i] = r[i] - alpha * mul_res[i];
-            z[i] = preconditioner[i] * r[i];
+        // Update the result and the residual
+        #pragma omp parallel for schedule(static) if(n > block_size)
+        for(std::uint32_t bl=0; bl<partials.size(); ++bl){
+            std::uint32_t begin = block_begin(bl), end = block_end(bl, n);
+            for(std::uint32_t i=begin; i<end; ++i){
+                x[i] = x[i] + alpha * p[i];
+                r[i] = r[i] - alpha * mul_res[i];
+                z[i] = preconditioner[i] * r[i];
+            }
+            partials[bl] = dot_prod<16>(r.data() + begin, z.data() + begin, end - begin);
         }
-        float new_cross_norm = dot_prod<16>(r, z); 
+        float new_cross_norm = sum_blocks(partials);
 
         // Update the scaled residual and the search direction
         if(k >= min_iter && new_cross_norm <= tol_ratio * start_norm){
@@ -317,52 +369,11 @@ std::vector<float> csr_matrix::solve_CG(std::vector<float> const & goal, std::ve
         }
         float beta = new_cross_norm / cross_norm;
         cross_norm = new_cross_norm;
-        for(uint32_t i=0; i<n; ++i)
+        #pragma omp parallel for schedule(static) if(n > block_size)
+        for(std::uint32_t i=0; i<n; ++i)
             p[i] = z[i] + beta * p[i];
     }
 
-    return x;
-}
-
-template<std::uint32_t unroll_len>
-std::vector<float> ellpack_matrix<unroll_len>::solve_CG(std::vector<float> goal, std::vector<float> x, std::uint32_t min_iter, std::uint32_t max_iter, float tol_ratio) const{
-    std::uint32_t n = diag.size();
-    std::uint32_t old_n = x.size();
-    assert(goal.size() == x.size());
-    x.resize(diag.size(), 0.0);
-    goal.resize(diag.size(), 0.0);
-
-    std::vector<float> r, p(n), z(n), mul_res, preconditioner(n);
-    r = mul(x);
-    for(uint32_t i=0; i<n; ++i){
-        r[i] = goal[i] - r[i];
-        preconditioner[i] = 1.0/diag[i];
-        z[i] = preconditioner[i] * r[i];
-        p[i] = z[i];
-    }
-
-    float cross_norm = dot_prod<unroll_len>(r, z);
-    float start_norm = cross_norm;
-    for(uint32_t k=0; k < max_iter; ++k){
-        mul_res = mul(p);
-        float alpha = cross_norm / dot_prod<unroll_len>(p, mul_res);
-        // Update the result
-        for(uint32_t i=0; i<n; ++i){
-            x[i] = x[i] + alpha * p[i];
-            r[i] = r[i] - alpha * mul_res[i];
-            z[i] = preconditioner[i] * r[i];
-        }
-        float new_cross_norm = dot_prod<unroll_len>(r, z); 
-
-        // Update the scaled residual and the search direction
-        if(k >= min_iter && new_cross_norm <= tol_ratio * start_norm){
-            break;
-        }
-        float beta = new_cross_norm / cross_norm;
-        cross_norm = new_cross_norm;
-        for(uint32_t i=0; i<n; ++i)
-            p[i] = z[i] + beta * p[i];
-    }
     x.resize(old_n);
     return x;
 }
@@ -372,7 +383,7 @@ std::vector<float_t> linear_system::solve_CG(std::vector<float_t> guess, index_t
     csr_matrix mat = tmp.get_compressed_matrix();
     //ellpack_matrix<16> mat = tmp.get_ellpack_matrix<16>();
     guess.resize(target_.size(), 0.0);
-    auto ret = mat.solve_CG(target_, guess, nbr_iter, nbr_iter, 0.0);
+    auto ret = coloquinte::gp::solve_CG(mat, target_, guess, nbr_iter, nbr_iter, 0.0);
     ret.resize(internal_size());
     return ret;
 }
@@ -40,6 +40,8 @@ param.addValue( 'Show every step' , 1 )
 param.addValue( 'Show lower bound', 2 )
 param.addValue( 'Show result only', 3 )
 
+Cfg.getParamInt( 'etesian.updatePeriod' ).setInt( 1 )
+
 layout  = Cfg.Configuration.get().getLayout()
 layout.addTab      ( 'Etesian', 'etesian' )
 layout.addTitle    ( 'Etesian', 'Placement area' )
@@ -51,4 +53,5 @@ layout.addParameter( 'Etesian', 'etesian.uniformDensity', 'Uniform density'
 layout.addParameter( 'Etesian', 'etesian.routingDriven' , 'Routing driven'       , 0 )
 layout.addParameter( 'Etesian', 'etesian.effort'        , 'Placement effort'     , 1 )
 layout.addParameter( 'Etesian', 'etesian.graphics'      , 'Placement view'       , 1 )
+layout.addParameter( 'Etesian', 'etesian.updatePeriod'  , 'View update period'   , 1 )
 layout.addRule     ( 'Etesian' )
@@ -22,6 +22,7 @@
 #include "hurricane/Library.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
+#include "hurricane/Timer.h"
 #include "hurricane/viewer/Graphics.h"
 #include "crlcore/Utilities.h"
 #include "crlcore/CellGauge.h"
@@ -47,6 +48,57 @@ namespace CRL {
   using Hurricane::getCollection;
   using Hurricane::Instance;
   using Hurricane::PrivateProperty;
+  using Hurricane::Timer;
+
+
+// -------------------------------------------------------------------
+// Class  :  "CRL::LoadTimer".
+//
+// Measures one parser call of AllianceFramework::getCell(). The time
+// spent in the nested getCell() (loading of the instances models) is
+// subtracted, so each view is charged only for its own parsing.
+
+
+  namespace {
+
+  class LoadTimer {
+    public:
+       LoadTimer ( unsigned int& depth, double& childsTime, double& viewTime, size_t& viewCount );
+      ~LoadTimer ();
+    private:
+      unsigned int&  _depth;
+      double&        _childsTime;
+      double&        _viewTime;
+      double         _savedChildsTime;
+      Timer          _timer;
+  };
+
+
+  LoadTimer::LoadTimer ( unsigned int& depth, double& childsTime, double& viewTime, size_t& viewCount )
+    : _depth          (depth)
+    , _childsTime     (childsTime)
+    , _viewTime       (viewTime)
+    , _savedChildsTime(childsTime)
+    , _timer          ()
+  {
+    ++_depth;
+    ++viewCount;
+    _childsTime = 0.0;
+    _timer.start();
+  }
+
+
+  LoadTimer::~LoadTimer ()
+  {
+    _timer.stop();
+    double elapsed = _timer.getCombTime();
+
+    _viewTime  += elapsed - _childsTime;
+    _childsTime = _savedChildsTime + elapsed;
+    --_depth;
+  }
+
+  }  // Anonymous namespace.
 
 
 // -------------------------------------------------------------------
@@ -195,6 +247,10 @@ namespace CRL {
     , _defaultRoutingGauge(NULL)
     , _cellGauges         ()
     , _defaultCellGauge   (NULL)
+    , _loadDepth          (0)
+    , _loadTimes          { 0.0, 0.0 }
+    , _loadCounts         { 0, 0 }
+    , _loadChildsTime     (0.0)
   {
     DataBase* db = DataBase::getDB();
     if (not db) db = DataBase::create();
@@ -347,9 +403,16 @@ namespace CRL {
   Cell* AllianceFramework::getCell ( const string& name, unsigned int mode, unsigned int depth )
   {
     bool              createCell = false;
+    bool              loaded     = false;
     Catalog::State*   state      = _catalog.getState( name );
     ParserFormatSlot* parser;
 
+    if (not _loadDepth) {
+      _loadTimes [0] = _loadTimes [1] = 0.0;
+      _loadCounts[0] = _loadCounts[1] = 0;
+      _loadChildsTime = 0.0;
+    }
+
     if (not _libraries.empty()) {
     // The cell is not even in the Catalog : add an entry.
       if (state == NULL) state = _catalog.getState( name, true );
@@ -389,14 +452,18 @@ namespace CRL {
 
         try {
         // Call the parser function.
+          LoadTimer loadTimer ( _loadDepth, _loadChildsTime, _loadTimes[i], _loadCounts[i] );
           (parser->getParsCell())( _environment.getLIBRARIES().getSelected() , state->getCell() );
         } catch ( ... ) {
           if (createCell) 
           //state->getCell()->destroy();
             throw;
         }
+        loaded = true;
       }
 
+      if (loaded and not _loadDepth) _printLoadStatistics( name );
+
     // At least one view must have been loaded.
       if (state->getFlags(Catalog::State::Views) != 0) {
         state->setFlags( Catalog::State::InMemory, true );
@@ -710,6 +777,18 @@ namespace CRL {
   }
 
 
+  void  AllianceFramework::_printLoadStatistics ( const string& name ) const
+  {
+    if (not cmess2.enabled()) return;
+
+    cmess2 << "  o  Load time breakdown of <" << name << ">." << endl;
+    cmess2 << Dots::asString( "     - Logical views"
+                            , getString(_loadCounts[0])+" in "+Timer::getStringTime(_loadTimes[0]) ) << endl;
+    cmess2 << Dots::asString( "     - Physical views"
+                            , getString(_loadCounts[1])+" in "+Timer::getStringTime(_loadTimes[1]) ) << endl;
+  }
+
+
   bool  AllianceFramework::_writeLocate ( const string& file, unsigned int mode, bool isLib )
   {
     SearchPath& LIBRARIES = _environment.getLIBRARIES ();
@@ -142,6 +142,10 @@ namespace CRL {
               RoutingGauge*            _defaultRoutingGauge;
               map<Name,CellGauge*>     _cellGauges;
               CellGauge*               _defaultCellGauge;
+              unsigned int             _loadDepth;
+              double                   _loadTimes  [2];
+              size_t                   _loadCounts [2];
+              double                   _loadChildsTime;
 
     // Internals - Constructors.
                                  AllianceFramework       ();
@@ -153,6 +157,7 @@ namespace CRL {
               bool               _readLocate             ( const string& file, unsigned int mode, bool isLib=false );
               bool               _writeLocate            ( const string& file, unsigned int mode, bool isLib=false );
               AllianceLibrary*   _createLibrary          ( const string& path, bool& hasCatalog );
+              void               _printLoadStatistics    ( const string& name ) const;
   };
 
   inline bool         AllianceFramework::isPOWER               ( const char*   name ) { return _environment.isPOWER(name); }
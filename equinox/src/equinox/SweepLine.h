@@ -32,6 +32,7 @@
 //#define ASSERT 1
 
 
+#include  <unordered_map>
 #include  "crlcore/Utilities.h"
 
 namespace Hurricane {
@@ -58,7 +59,7 @@ namespace Equinox {
   class SweepLine  {
     
   private : 
-    map<ITEM , IntervalTreeNode*> _intervalTreeNodeMap; 
+    unordered_map<ITEM , IntervalTreeNode*> _intervalTreeNodeMap; 
     int                            intervalsize;
     float                          intervaltime;
     int                            contactssize;
@@ -323,8 +324,9 @@ inline  void SweepLine<ITEM,ENGINE>::insertInterval(ITEM item)
 
 #ifdef INTERVALTREE
     //Suppression du Item
-    mySetsIt->second->DeleteNode(_intervalTreeNodeMap[item]);
-   _intervalTreeNodeMap.erase(item);  
+    typename unordered_map<ITEM , IntervalTreeNode*>::iterator inode = _intervalTreeNodeMap.find(item);
+    mySetsIt->second->DeleteNode(inode->second);
+   _intervalTreeNodeMap.erase(inode);  
 #else
    mySetsIt->second->erase(item);
 #endif
@@ -57,6 +57,7 @@ namespace Etesian {
                           (Cfg::getParamEnumerate ("etesian.effort"         , Standard   )->asInt()) )
     , _updateConf       ( static_cast<GraphicUpdate>                        
                           (Cfg::getParamEnumerate ("etesian.graphics"       , LowerBound )->asInt()) )
+    , _updatePeriod     ( 1 )
     , _spreadingConf    (  Cfg::getParamBool      ("etesian.uniformDensity" , false      )->asBool()? ForceUniform : MaxDensity )
     , _routingDriven    (  Cfg::getParamBool      ("etesian.routingDriven"  , false      )->asBool())
     , _spaceMargin      (  Cfg::getParamPercentage("etesian.spaceMargin"    ,  5.0)->asDouble() )
@@ -89,6 +90,9 @@ namespace Etesian {
     _rg = rg->getClone();
     _cg = cg->getClone();
 
+    int updatePeriod = Cfg::getParamInt( "etesian.updatePeriod", 1 )->asInt();
+    _updatePeriod = (updatePeriod < 1) ? 1 : updatePeriod;
+
     if (_antennaGateMaxWL and not _antennaDiodeMaxWL) {
       _antennaDiodeMaxWL = _antennaGateMaxWL;
       cerr << Warning( "Etesian::Configuration(): \"etesian.antennaGateMaxWL\" is defined but not \"etesian.antennaDiodeMaxWL\".\n"
@@ -104,6 +108,7 @@ namespace Etesian {
     , _cg               (NULL)
     , _placeEffort      ( other._placeEffort     )
     , _updateConf       ( other._updateConf      )
+    , _updatePeriod     ( other._updatePeriod    )
     , _spreadingConf    ( other._spreadingConf   )
     , _spaceMargin      ( other._spaceMargin     )
     , _aspectRatio      ( other._aspectRatio     )
@@ -138,6 +143,7 @@ namespace Etesian {
     cmess1 << Dots::asIdentifier("     - Cell Gauge"       ,getString(_cg->getName())) << endl;
     cmess1 << Dots::asInt       ("     - Place Effort"     ,_placeEffort             ) << endl;
     cmess1 << Dots::asInt       ("     - Update Conf"      ,_updateConf              ) << endl;
+    cmess1 << Dots::asUInt      ("     - Update Period"    ,_updatePeriod            ) << endl;
     cmess1 << Dots::asInt       ("     - Spreading Conf"   ,_spreadingConf           ) << endl;
     cmess1 << Dots::asBool      ("     - Routing driven"   ,_routingDriven           ) << endl;
     cmess1 << Dots::asPercentage("     - Space Margin"     ,_spaceMargin             ) << endl;
@@ -171,6 +177,7 @@ namespace Etesian {
     record->add ( getSlot( "_cg"                    ,       _cg              ) );
     record->add ( getSlot( "_placeEffort"           ,  (int)_placeEffort     ) );
     record->add ( getSlot( "_updateConf"            ,  (int)_updateConf      ) );
+    record->add ( getSlot( "_updatePeriod"          ,       _updatePeriod    ) );
     record->add ( getSlot( "_spreadingConf"         ,  (int)_spreadingConf   ) );
     record->add ( getSlot( "_spaceMargin"           ,       _spaceMargin     ) );
     record->add ( getSlot( "_aspectRatio"           ,       _aspectRatio     ) );
@@ -1164,10 +1164,14 @@ namespace Etesian {
             lowerWL = static_cast<float_t>(get_HPWL_wirelength(*_circuit, *_placementLB));
     float_t prevOptRatio = lowerWL / upperWL;
 
+  // Hurricane is only synchronized every "etesian.updatePeriod" iterations,
+  // the placer itself works on the Coloquinte placements only.
     index_t i=0;
     do{
+      bool checkpoint = (i % getUpdatePeriod() == 0);
+
       roughLegalize(minDisruption, options);
-      if(options & UpdateUB)
+      if((options & UpdateUB) and checkpoint)
         _updatePlacement( _placementUB );
 
       ostringstream label;
@@ -1193,7 +1197,7 @@ namespace Etesian {
       solve_linear_system( *_circuit, *_placementLB, solv, 200 ); // 200 iterations
       _progressReport2("                    Linear." );
 
-      if(options & UpdateLB)
+      if((options & UpdateLB) and checkpoint)
         _updatePlacement( _placementUB );
 
       // Optimize orientation sometimes
@@ -1230,7 +1234,10 @@ namespace Etesian {
       // First way to exit the loop: UB and LB difference is <10%
       // Second way to exit the loop: the legalization is close enough to the previous result
     } while (linearDisruption > minDisruption and prevOptRatio <= 0.9);
-    _updatePlacement( _placementUB );
+
+  // When only the result is shown, detailedPlace() does the first update.
+    if (options & (UpdateUB|UpdateLB))
+      _updatePlacement( _placementUB );
   }
 
 
@@ -1244,26 +1251,28 @@ namespace Etesian {
     // TODO: for uniform density distribution, add some margin to the cell sizes so we don't disrupt it during detailed placement
 
     for ( int i=0; i<iterations; ++i ){
+        bool checkpoint = (options & UpdateDetailed) and (i % getUpdatePeriod() == 0);
+
         ostringstream label;
         label.str("");
         label  << "     [" << setw(3) << setfill('0') << i << setfill(' ') << "]";
 
         optimize_x_orientations( *_circuit, *_placementUB ); // Don't disrupt VDD/VSS connections in a row
         _progressReport1(label.str() + " Oriented ......." );
-        if(options & UpdateDetailed)
+        if(checkpoint)
           _updatePlacement( _placementUB );
 
         auto legalizer = legalize( *_circuit, *_placementUB, *_surface, sliceHeight );
         coloquinte::dp::get_result( *_circuit, legalizer, *_placementUB );
         _progressReport1("           Legalized ......" );
-        if(options & UpdateDetailed)
+        if(checkpoint)
           _updatePlacement( _placementUB );
 
         row_compatible_orientation( *_circuit, legalizer, true );
         swaps_global_HPWL( *_circuit, legalizer, 3, 4 );
         coloquinte::dp::get_result( *_circuit, legalizer, *_placementUB );
         _progressReport1("           Global Swaps ..." );
-        if(options & UpdateDetailed)
+        if(checkpoint)
           _updatePlacement( _placementUB );
 
         if(options & SteinerModel)
@@ -1272,7 +1281,7 @@ namespace Etesian {
           OSRP_convex_HPWL( *_circuit, legalizer );
         coloquinte::dp::get_result( *_circuit, legalizer, *_placementUB );
         _progressReport1("           Row Optimization" );
-        if(options & UpdateDetailed)
+        if(checkpoint)
           _updatePlacement( _placementUB );
 
         if(options & SteinerModel)
@@ -1281,7 +1290,7 @@ namespace Etesian {
           swaps_row_convex_HPWL( *_circuit, legalizer, effort+2 );
         coloquinte::dp::get_result( *_circuit, legalizer, *_placementUB );
         _progressReport1("           Local Swaps ...." );
-        if(options & UpdateDetailed)
+        if(checkpoint)
           _updatePlacement( _placementUB );
 
         if (i == iterations-1) {
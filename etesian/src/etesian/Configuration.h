@@ -63,6 +63,7 @@ namespace Etesian {
       inline CellGauge*       getCellGauge              () const;
       inline Effort           getPlaceEffort            () const;
       inline GraphicUpdate    getUpdateConf             () const;
+      inline uint32_t         getUpdatePeriod           () const;
       inline Density          getSpreadingConf          () const;
       inline bool             getRoutingDriven          () const;
       inline double           getSpaceMargin            () const;
@@ -88,6 +89,7 @@ namespace Etesian {
       CellGauge*     _cg;
       Effort         _placeEffort;
       GraphicUpdate  _updateConf;
+      uint32_t       _updatePeriod;
       Density        _spreadingConf;
       bool           _routingDriven;
       double         _spaceMargin;
@@ -111,6 +113,7 @@ namespace Etesian {
   inline CellGauge*    Configuration::getCellGauge              () const { return _cg; }
   inline Effort        Configuration::getPlaceEffort            () const { return _placeEffort; }
   inline GraphicUpdate Configuration::getUpdateConf             () const { return _updateConf; }
+  inline uint32_t      Configuration::getUpdatePeriod           () const { return _updatePeriod; }
   inline Density       Configuration::getSpreadingConf          () const { return _spreadingConf; }
   inline bool          Configuration::getRoutingDriven          () const { return _routingDriven; }
   inline double        Configuration::getSpaceMargin            () const { return _spaceMargin; }
@@ -91,6 +91,7 @@ namespace Etesian {
       inline  DbU::Unit              getFixedAbWidth           () const;
       inline  Effort                 getPlaceEffort            () const;
       inline  GraphicUpdate          getUpdateConf             () const;
+      inline  uint32_t               getUpdatePeriod           () const;
       inline  Density                getSpreadingConf          () const;
       inline  double                 getSpaceMargin            () const;
       inline  double                 getAspectRatio            () const;
@@ -211,6 +212,7 @@ namespace Etesian {
   inline  DbU::Unit              EtesianEngine::getFixedAbWidth           () const { return _fixedAbWidth; }
   inline  Effort                 EtesianEngine::getPlaceEffort            () const { return getConfiguration()->getPlaceEffort(); }
   inline  GraphicUpdate          EtesianEngine::getUpdateConf             () const { return getConfiguration()->getUpdateConf(); }
+  inline  uint32_t               EtesianEngine::getUpdatePeriod           () const { return getConfiguration()->getUpdatePeriod(); }
   inline  Density                EtesianEngine::getSpreadingConf          () const { return getConfiguration()->getSpreadingConf(); }
   inline  double                 EtesianEngine::getSpaceMargin            () const { return getConfiguration()->getSpaceMargin(); }
   inline  double                 EtesianEngine::getAspectRatio            () const { return getConfiguration()->getAspectRatio(); }
@@ -55,6 +55,8 @@ DTYPE wirelength(Tree t);
 void printtree(Tree t);
 void plottree(Tree t);
 
+static bool lutLoaded = false;  // LUT & numsoln are read-only once loaded
+
 void readLUT( string directory )
 {
     unsigned char charnum[256], line[32], *linep, c;
@@ -62,6 +64,9 @@ void readLUT( string directory )
     struct csoln *p;
     int d, i, j, k, kk, ns, nn;
 
+    // The tables do not depend on the caller, parse them only the first time.
+    if (lutLoaded) return;
+
     init_param();
     
     for (i=0; i<=255; i++) {
@@ -140,6 +145,12 @@ void readLUT( string directory )
             }
         }
     }
+
+    fclose(fpwv);
+#if ROUTING==1
+    fclose(fprt);
+#endif
+    lutLoaded = true;
 }
 
 DTYPE flute_wl(int d, DTYPE x[], DTYPE y[], int acc)
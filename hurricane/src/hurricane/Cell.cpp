@@ -1381,8 +1381,8 @@ void Cell::_toJsonCollections(JsonWriter* writer) const
 // *****************************************
 {
   writer->setFlags( JsonWriter::CellObject );
-  jsonWrite( writer, "+instanceMap", getInstances() );
-  jsonWrite( writer, "+netMap"     , getNets() );
+  jsonWrite( writer, "+instanceMap", Instances(getInstances()) );
+  jsonWrite( writer, "+netMap"     , Nets(getNets()) );
   Inherit::_toJsonCollections( writer );
   writer->resetFlags( JsonWriter::CellObject );
 }
@@ -14,6 +14,7 @@
 // +-----------------------------------------------------------------+
 
 
+#include <cstring>
 #include <bzlib.h>
 #include "hurricane/Error.h"
 #include "hurricane/FileReadGzStream.h"
@@ -59,24 +60,60 @@ namespace Hurricane {
       ++current_;
     else if (not eof_) {
       count_     += readCount_;
-      readCount_  = BZ2_bzRead( &bzerror_, bzfp_, buffer_, bufferSize_ );
+      readCount_  = 0;
+
+      while ( (readCount_ < bufferSize_) and not eof_ ) {
+        readCount_ += BZ2_bzRead( &bzerror_, bzfp_, buffer_+readCount_, bufferSize_-readCount_ );
+        if (bzerror_ == BZ_OK) continue;
+        if (bzerror_ == BZ_STREAM_END) {
+          if (NextStream()) continue;
+        } else {
+          cerr << Error( "FileReadGzStream::Read(): Unexpected termination of bzip2 stream." ) << endl;
+          BZ2_bzReadClose ( &bzerror_, bzfp_ );
+          bzfp_ = NULL;
+        }
+        eof_ = true;
+      }
+
       bufferLast_ = buffer_ + readCount_ - 1;
       current_    = buffer_;
-      
       if (readCount_ < bufferSize_) {
         buffer_[readCount_] = '\0';
         ++bufferLast_;
-        eof_ = true;
       }
+    }
+  }
 
-      if (bzerror_ != BZ_OK) {
-        eof_ = true;
-        if (bzerror_ != BZ_STREAM_END) {
-          cerr << Error( "FileReadGzStream::Read(): Unexpected termination of bzip2 stream." ) << endl;
-        }
-        BZ2_bzReadClose ( &bzerror_, bzfp_ );
-      }
+
+  bool  FileReadGzStream::NextStream ()
+  {
+  // The file may be made of several concatenated bzip2 streams (chunks
+  // compressed in parallel by FileWriteGzStream). Reopen on whatever
+  // follows the stream that just ended.
+    void* unused  = NULL;
+    int   nUnused = 0;
+    char  saved [ BZ_MAX_UNUSED ];
+
+    BZ2_bzReadGetUnused( &bzerror_, bzfp_, &unused, &nUnused );
+    if (bzerror_ == BZ_OK) memcpy( saved, unused, nUnused );
+    else                   nUnused = 0;
+
+    BZ2_bzReadClose( &bzerror_, bzfp_ );
+    bzfp_ = NULL;
+
+    if (not nUnused) {
+      int c = fgetc( fp_ );
+      if (c == EOF) return false;
+      ungetc( c, fp_ );
+    }
+
+    bzfp_ = BZ2_bzReadOpen( &bzerror_, fp_, 0, 0, saved, nUnused );
+    if (bzerror_ != BZ_OK) {
+      cerr << Error( "FileReadGzStream::NextStream(): Unable to initialize next bzip2 stream." ) << endl;
+      bzfp_ = NULL;
+      return false;
     }
+    return true;
   }
 
 
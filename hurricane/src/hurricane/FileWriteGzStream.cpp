@@ -14,11 +14,37 @@
 // +-----------------------------------------------------------------+
 
 
+#include <algorithm>
+#include <thread>
 #include <bzlib.h>
 #include "hurricane/Error.h"
 #include "hurricane/FileWriteGzStream.h"
 
 
+namespace {
+
+
+// Compress one chunk as a standalone bzip2 stream (runs in a worker).
+// An empty result means failure, a non-empty input never compresses
+// into nothing.
+  std::string  compressChunk ( std::string chunk )
+  {
+    unsigned int  size   = chunk.size() + chunk.size()/100 + 600;  // bzip2 worst case.
+    std::string   packed ( size, '\0' );
+
+    int status = BZ2_bzBuffToBuffCompress( &packed[0], &size
+                                         , &chunk[0], chunk.size()
+                                         , 9, 0, 0 );
+    if (status != BZ_OK) return std::string();
+
+    packed.resize( size );
+    return packed;
+  }
+
+
+}  // Anonymous namespace.
+
+
 namespace Hurricane {
 
 
@@ -30,50 +56,44 @@ namespace Hurricane {
                                        , size_t     bufferSize
                                        )
     : fp_       (fp)
-    , bzfp_     (NULL)
     , buffer_   (buffer)
     , bufferEnd_(buffer + bufferSize), current_(buffer_)
-    , bzerror_  (BZ_OK)
+    , workers_  (std::max( std::thread::hardware_concurrency(), 1U ))
+    , chunks_   ()
+    , error_    (false)
   { 
     assert(fp_ != 0);
-
-    bzfp_ = BZ2_bzWriteOpen( &bzerror_, fp_, 9, 0, 0 );
-    if (bzerror_ != BZ_OK) {
-      cerr << Error( "FileWriteGzStream::FileWriteGzstream(): Unable to initialize bzip2 stream." ) << endl;
-    }
   }
 
 
   FileWriteGzStream::~FileWriteGzStream ()
   {
-    if (not bzfp_) return;
-
-    unsigned int  bytesin  = 0;
-    unsigned int  bytesout = 0;
-    
-    BZ2_bzWriteClose( &bzerror_, bzfp_, 0, &bytesin, &bytesout );
-    if (bzerror_ != BZ_OK) {
-      cerr << Error( "FileWriteGzStream::~FileWritegzstream(): I/O error while closing stream." ) << endl;
-    }
+    Flush();
+    while (not chunks_.empty()) WriteChunk();
   }
 
 
   void FileWriteGzStream::Flush ()
   {
     if (current_ != buffer_) {
-      BZ2_bzWrite( &bzerror_,bzfp_, buffer_, static_cast<int>(current_ - buffer_) );
-      if (bzerror_ != BZ_OK) {
-        unsigned int  bytesin  = 0;
-        unsigned int  bytesout = 0;
-
-        BZ2_bzWriteClose( &bzerror_, bzfp_, 0, &bytesin, &bytesout );
-        if (bzerror_ != BZ_OK) {
-          cerr << Error( "FileWriteGzStream::Write(): I/O error in bzip2 stream." ) << endl;
-        }
-      }
+      if (chunks_.size() >= workers_) WriteChunk();
+      chunks_.push_back( std::async( std::launch::async, compressChunk, std::string(buffer_,current_) ) );
       current_ = buffer_;
     }
   }
 
 
+  void FileWriteGzStream::WriteChunk ()
+  {
+    std::string packed = chunks_.front().get();
+    chunks_.pop_front();
+
+    if (error_) return;
+    if (packed.empty() or (fwrite( packed.data(), 1, packed.size(), fp_ ) != packed.size())) {
+      cerr << Error( "FileWriteGzStream::WriteChunk(): I/O error in bzip2 stream." ) << endl;
+      error_ = true;
+    }
+  }
+
+
 }  // Hurricane namespace.
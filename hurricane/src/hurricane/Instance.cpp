@@ -673,7 +673,7 @@ void Instance::_toJson( JsonWriter* writer ) const
 void Instance::_toJsonCollections(JsonWriter* writer) const
 // ********************************************************
 {
-  jsonWrite( writer, "+plugMap", getPlugs() );
+  jsonWrite( writer, "+plugMap", Plugs(getPlugs()) );
   Inherit::_toJsonCollections( writer );
 }
 
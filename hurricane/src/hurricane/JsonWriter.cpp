@@ -48,7 +48,7 @@
 
   JsonWriter::JsonWriter ( std::string fileName )
     : _flags     (0)
-    , _bufferSize(65536)
+    , _bufferSize(900*1024)   // One bzip2 block (-9) per compressed chunk.
     , _buffer    (new char [_bufferSize])
     , _file      (NULL)
     , _stream    (NULL)
@@ -36,17 +36,7 @@ Name::Name()
 // *********
 :  _sharedName(NULL)
 {
-    string s = "";
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
+    _sharedName = SharedName::_get("");
 
     assert(_sharedName);
 
@@ -57,17 +47,7 @@ Name::Name(const char* c)
 // **********************
 :  _sharedName(NULL)
 {
-    string s = c;
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
+    _sharedName = SharedName::_get(c);
 
     assert(_sharedName);
 
@@ -78,16 +58,7 @@ Name::Name(const string& s)
 // ************************
 :  _sharedName(NULL)
 {
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
+    _sharedName = SharedName::_get(s);
 
     assert(_sharedName);
 
@@ -833,7 +833,7 @@ void Net::_toJsonCollections(JsonWriter* writer) const
 {
   jsonWrite( writer, "+aliases", getAliases() );
   writer->setFlags( JsonWriter::UsePlugReference );
-  jsonWrite( writer, "+componentSet", getComponents() );
+  jsonWrite( writer, "+componentSet", Components(getComponents()) );
   writer->resetFlags( JsonWriter::UsePlugReference );
 
   writer->key( "+externalComponents" );
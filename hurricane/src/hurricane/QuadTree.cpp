@@ -31,8 +31,15 @@ namespace Hurricane {
 // Definitions
 // ****************************************************************************************************
 
+// Both thresholds can be overriden at build time (-D) to tune the
+// depth of the tree against the number of Gos stored per node.
+
+#ifndef QUAD_TREE_IMPLODE_THRESHOLD
 #define QUAD_TREE_IMPLODE_THRESHOLD 80
+#endif
+#ifndef QUAD_TREE_EXPLODE_THRESHOLD
 #define QUAD_TREE_EXPLODE_THRESHOLD 100
+#endif
 
 
 
@@ -125,7 +132,8 @@ class QuadTree_GosUnder : public Collection<Go*> {
         private: Box _area;
         private: DbU::Unit _threshold;
         private: QuadTree* _currentQuadTree;
-        private: GoLocator _goLocator;
+        private: unsigned _index;
+        private: Go* _go;
       //private: static size_t _allocateds;
 
         public: Locator();
@@ -145,6 +153,10 @@ class QuadTree_GosUnder : public Collection<Go*> {
 
         public: virtual string _getString() const;
 
+        private: void _firstGo();
+        private: void _nextGo();
+        private: bool _isAccepted(Go* go) const;
+
     };
 
 // Attributes
@@ -762,7 +774,8 @@ QuadTree_GosUnder::Locator::Locator()
     _area(),
     _threshold(0),
     _currentQuadTree(NULL),
-    _goLocator()
+    _index(0),
+    _go(NULL)
 {
   //_allocateds++;
 }
@@ -774,7 +787,8 @@ QuadTree_GosUnder::Locator::Locator(const QuadTree* quadTree, const Box& area, D
     _area(area),
     _threshold(threshold),
     _currentQuadTree(NULL),
-    _goLocator()
+    _index(0),
+    _go(NULL)
 {
     //_allocateds++;
     if (_quadTree and not _area.isEmpty()) {
@@ -793,8 +807,8 @@ QuadTree_GosUnder::Locator::Locator(const QuadTree* quadTree, const Box& area, D
 
       //_currentQuadTree = _quadTree->_getFirstQuadTree(_area);
         if (_currentQuadTree) {
-            _goLocator = _currentQuadTree->_getGoSet().getElements().getLocator();
-            if (!getElement()->getBoundingBox().intersect(_area)) progress();
+            _firstGo();
+            if (isValid() and not _isAccepted(_go)) progress();
         }
     }
 }
@@ -806,7 +820,8 @@ QuadTree_GosUnder::Locator::Locator(const Locator& locator)
     _area(locator._area),
     _threshold(locator._threshold),
     _currentQuadTree(locator._currentQuadTree),
-    _goLocator(locator._goLocator)
+    _index(locator._index),
+    _go(locator._go)
 {
   //_allocateds++;
 }
@@ -818,14 +833,15 @@ QuadTree_GosUnder::Locator& QuadTree_GosUnder::Locator::operator=(const Locator&
     _area = locator._area;
     _threshold = locator._threshold;
     _currentQuadTree = locator._currentQuadTree;
-    _goLocator = locator._goLocator;
+    _index = locator._index;
+    _go = locator._go;
     return *this;
 }
 
 Go* QuadTree_GosUnder::Locator::getElement() const
 // ***********************************************
 {
-    return _goLocator.getElement();
+    return _go;
 }
 
 Locator<Go*>* QuadTree_GosUnder::Locator::getClone() const
@@ -837,7 +853,7 @@ Locator<Go*>* QuadTree_GosUnder::Locator::getClone() const
 bool QuadTree_GosUnder::Locator::isValid() const
 // *********************************************
 {
-    return _goLocator.isValid();
+    return (_go != NULL);
 }
 
 void QuadTree_GosUnder::Locator::progress()
@@ -845,8 +861,8 @@ void QuadTree_GosUnder::Locator::progress()
 {
   if (isValid()) {
     do {
-      _goLocator.progress();
-      if (not _goLocator.isValid()) {
+      _nextGo();
+      if (not _go) {
         while ( true ) {
           _currentQuadTree = _currentQuadTree->_getNextQuadTree(_area);
           if (not _currentQuadTree) break;
@@ -859,8 +875,7 @@ void QuadTree_GosUnder::Locator::progress()
           //      << "(" << _threshold << ")" << endl;
         }
 
-        if (_currentQuadTree)
-          _goLocator = _currentQuadTree->_getGoSet().getElements().getLocator();
+        if (_currentQuadTree) _firstGo();
       }
       // if (isValid()) {
       //   if ((   (getElement()->getBoundingBox().getWidth () < _threshold)
@@ -869,10 +884,7 @@ void QuadTree_GosUnder::Locator::progress()
       //   else
       //     cerr << "    goUnders: display " << getElement() << endl;
       // }
-    } while (   isValid()
-            and (  not  getElement()->getBoundingBox().intersect(_area)
-                or (   (getElement()->getBoundingBox().getWidth () < _threshold)
-                   and (getElement()->getBoundingBox().getHeight() < _threshold))) );
+    } while (isValid() and not _isAccepted(_go));
   }
   // if (isValid()) {
   //   cerr << "    goUnders: accept " << getElement() << endl;
@@ -891,6 +903,38 @@ string QuadTree_GosUnder::Locator::_getString() const
     return s;
 }
 
+void QuadTree_GosUnder::Locator::_firstGo()
+// ****************************************
+{
+    _index = 0;
+    _go = NULL;
+    _nextGo();
+}
+
+void QuadTree_GosUnder::Locator::_nextGo()
+// ***************************************
+// Walks the buckets of the current GoSet in place, so going through a
+// QuadTree node doesn't allocate a new GoSet locator on the heap.
+{
+    const QuadTree::GoSet& goSet  = _currentQuadTree->_getGoSet();
+    Go**                   array  = goSet._getArray();
+    unsigned               length = goSet._getLength();
+
+    if (_go) _go = goSet._getNextElement(_go);
+    while (!_go and (_index < length)) _go = array[_index++];
+}
+
+bool QuadTree_GosUnder::Locator::_isAccepted(Go* go) const
+// *******************************************************
+// The bounding box of a Go may be costly to compute (Instance), so it
+// is evaluated only once per Go.
+{
+    Box boundingBox = go->getBoundingBox();
+    if (not boundingBox.intersect(_area)) return false;
+    return (boundingBox.getWidth () >= _threshold)
+        or (boundingBox.getHeight() >= _threshold);
+}
+
 
 
 } // End of Hurricane namespace.
@@ -18,6 +18,8 @@
 // ****************************************************************************************************
 
 #include <limits>
+#include <cstdint>
+#include <algorithm>
 #include "hurricane/Error.h"
 #include "hurricane/SharedName.h"
 
@@ -29,18 +31,17 @@ namespace Hurricane {
 // SharedName implementation
 // ****************************************************************************************************
 
-  SharedName::SharedNameMap* SharedName::_SHARED_NAME_MAP = NULL;
+  SharedName** SharedName::_SHARED_NAME_TABLE = NULL;
+  size_t       SharedName::_tableBits         = 0;
+  size_t       SharedName::_tableCount        = 0;
 
 
-  SharedName::SharedName ( const string& name )
-    : _hash  (0)
+  SharedName::SharedName ( const string& name, unsigned long hash )
+    : _hash  (hash)
     , _count (0)
     , _string(name)
 {
-    if (!_SHARED_NAME_MAP) _SHARED_NAME_MAP = new SharedNameMap();
-    (*_SHARED_NAME_MAP)[&_string] = this;
-
-    for ( char c : _string ) _hash = 131 * _hash + int(c);
+    _insert( this );
 
     // if (_idCounter == std::numeric_limits<unsigned long>::max()) {
     //   throw Error( "SharedName::SharedName(): Identifier counter has reached it's limit (%d bits)."
@@ -53,7 +54,7 @@ namespace Hurricane {
 SharedName::~SharedName()
 // **********************
 {
-    _SHARED_NAME_MAP->erase(&_string);
+    _erase( this );
 }
 
 void SharedName::capture()
@@ -86,21 +87,108 @@ Record* SharedName::_getRecord() const
 void  SharedName::dump ()
 // **********************
 {
-  cerr << "_SHARED_NAME_MAP contents:" << endl;
-  for ( auto item : *_SHARED_NAME_MAP ) {
-    cerr << "- [" << item.first << "] = " << item.second << endl;
+  vector<SharedName*> sharedNames;
+  size_t              tableSize = (_SHARED_NAME_TABLE) ? ((size_t)1 << _tableBits) : 0;
+  for ( size_t i=0 ; i<tableSize ; ++i ) {
+    if (_SHARED_NAME_TABLE[i]) sharedNames.push_back( _SHARED_NAME_TABLE[i] );
+  }
+  sort( sharedNames.begin(), sharedNames.end()
+      , [](SharedName* lhs, SharedName* rhs) { return lhs->_string < rhs->_string; } );
+
+  cerr << "_SHARED_NAME_TABLE contents (" << _tableCount << "/" << tableSize << "):" << endl;
+  for ( SharedName* sharedName : sharedNames ) {
+    cerr << "- [" << sharedName->_string << "] = " << sharedName << endl;
   }
 }
 
 
 // ****************************************************************************************************
-// SharedName::SharedNameMapComparator
+// SharedName table management
 // ****************************************************************************************************
 
-bool SharedName::SharedNameMapComparator::operator()(string* s1, string* s2) const
-// *******************************************************************************
+unsigned long  SharedName::_computeHash ( const string& s )
+// ********************************************************
+{
+  unsigned long hash = 0;
+  for ( char c : s ) hash = 131 * hash + int(c);
+  return hash;
+}
+
+size_t  SharedName::_getSlot ( unsigned long hash )
+// ************************************************
+// Fibonacci hashing: spreads the (weakly mixed) string hash over the
+// table, using its upper bits.
+{
+  return (size_t)( ((uint64_t)hash * 11400714819323198485ull) >> (64 - _tableBits) );
+}
+
+SharedName* SharedName::_get ( const string& s )
+// *********************************************
+{
+  unsigned long hash = _computeHash( s );
+
+  if (_SHARED_NAME_TABLE) {
+    size_t mask = ((size_t)1 << _tableBits) - 1;
+    for ( size_t i=_getSlot(hash) ; _SHARED_NAME_TABLE[i] ; i=(i+1) & mask ) {
+      SharedName* sharedName = _SHARED_NAME_TABLE[i];
+      if ((sharedName->_hash == hash) and (sharedName->_string == s)) return sharedName;
+    }
+  }
+  return new SharedName( s, hash );
+}
+
+void  SharedName::_insert ( SharedName* sharedName )
+// *************************************************
 {
-    return (*s1) < (*s2);
+  if (not _SHARED_NAME_TABLE)
+    _resize( 10 );
+  else if (2*(_tableCount+1) > ((size_t)1 << _tableBits))
+    _resize( _tableBits+1 );
+
+  size_t mask = ((size_t)1 << _tableBits) - 1;
+  size_t i    = _getSlot( sharedName->_hash );
+  while ( _SHARED_NAME_TABLE[i] ) i = (i+1) & mask;
+
+  _SHARED_NAME_TABLE[i] = sharedName;
+  ++_tableCount;
+}
+
+void  SharedName::_erase ( SharedName* sharedName )
+// ************************************************
+{
+  size_t mask = ((size_t)1 << _tableBits) - 1;
+  size_t i    = _getSlot( sharedName->_hash );
+  while ( _SHARED_NAME_TABLE[i] != sharedName ) i = (i+1) & mask;
+
+// Backward shift deletion: no tombstones, the probe sequences of the
+// following entries are kept contiguous.
+  for ( size_t j=(i+1) & mask ; _SHARED_NAME_TABLE[j] ; j=(j+1) & mask ) {
+    size_t home = _getSlot( _SHARED_NAME_TABLE[j]->_hash );
+    bool   move = (i <= j) ? ((home <= i) or (home > j))
+                           : ((home <= i) and (home > j));
+    if (move) {
+      _SHARED_NAME_TABLE[i] = _SHARED_NAME_TABLE[j];
+      i = j;
+    }
+  }
+  _SHARED_NAME_TABLE[i] = NULL;
+  --_tableCount;
+}
+
+void  SharedName::_resize ( size_t bits )
+// **************************************
+{
+  SharedName** oldTable = _SHARED_NAME_TABLE;
+  size_t       oldSize  = (oldTable) ? ((size_t)1 << _tableBits) : 0;
+
+  _tableBits         = bits;
+  _tableCount        = 0;
+  _SHARED_NAME_TABLE = new SharedName* [ (size_t)1 << _tableBits ] ();
+
+  for ( size_t i=0 ; i<oldSize ; ++i ) {
+    if (oldTable[i]) _insert( oldTable[i] );
+  }
+  delete [] oldTable;
 }
 
 
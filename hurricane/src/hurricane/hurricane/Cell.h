@@ -412,7 +412,7 @@ class Cell : public Entity {
     public: Path getShuntedPath() const { return _shuntedPath; }
     public: Entity* getEntity(const Signature&) const;
     public: Instance* getInstance(const Name& name) const {return _instanceMap.getElement(name);};
-    public: Instances getInstances() const {return _instanceMap.getElements();};
+    public: InstanceMap::Elements getInstances() const {return _instanceMap.getElements();};
     public: Instances getPlacedInstances() const;
     public: Instances getFixedInstances() const;
     public: Instances getUnplacedInstances() const;
@@ -433,7 +433,7 @@ class Cell : public Entity {
     public: Instances getNonTerminalNetlistInstancesUnder(const Box& area) const;
     public: Net* getNet(const Name& name, bool useAlias=true) const;
     public: DeepNet* getDeepNet( Path, const Net* ) const;
-    public: Nets getNets() const {return _netMap.getElements();};
+    public: NetMap::Elements getNets() const {return _netMap.getElements();};
     public: Nets getGlobalNets() const;
     public: Nets getExternalNets() const;
     public: Nets getInternalNets() const;
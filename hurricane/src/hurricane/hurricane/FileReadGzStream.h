@@ -44,6 +44,7 @@ namespace Hurricane {
       inline const Ch* Peek4            () const;
     private:                            
              void      Read             (); 
+             bool      NextStream       ();
     private:
       std::FILE* fp_;
       BZFILE*    bzfp_;
@@ -17,6 +17,9 @@
 #ifndef HURRICANE_FILEWRITEGZSTREAM_H
 #define HURRICANE_FILEWRITEGZSTREAM_H
 
+#include <string>
+#include <deque>
+#include <future>
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/filewritestream.h"
 
@@ -26,6 +29,15 @@ namespace Hurricane {
   typedef  void  BZFILE;  // Must be identical to the typedef in <bzlib.h>.
 
 
+// -------------------------------------------------------------------
+// Class  :  "FileWriteGzStream".
+//
+// Each time the buffer is flushed, its contents are compressed as an
+// independent bzip2 stream by a worker thread, so the compression runs
+// in parallel with the JSON generation and with the other chunks.
+// The compressed chunks are written back in order, the file being a
+// valid multi-stream bzip2 file (as produced by pbzip2).
+
   class FileWriteGzStream {
     public:
       typedef  char  Ch;
@@ -43,13 +55,15 @@ namespace Hurricane {
     private:
                                 FileWriteGzStream ( const FileWriteGzStream& );
              FileWriteGzStream& operator=         ( const FileWriteGzStream& );
+             void               WriteChunk        ();
     private:
-      std::FILE* fp_;
-      BZFILE*    bzfp_;
-      char*      buffer_;
-      char*      bufferEnd_;
-      char*      current_;
-      int        bzerror_;
+      std::FILE*                            fp_;
+      char*                                 buffer_;
+      char*                                 bufferEnd_;
+      char*                                 current_;
+      size_t                                workers_;
+      std::deque< std::future<std::string> > chunks_;
+      bool                                  error_;
   };
 
 
@@ -122,7 +122,7 @@ class Instance : public Go {
     public: const Transformation& getTransformation() const {return _transformation;};
     public: const PlacementStatus& getPlacementStatus()  const {return _placementStatus;};
     public: Plug* getPlug(const Net* masterNet) const {return _plugMap.getElement(masterNet);};
-    public: Plugs getPlugs() const {return _plugMap.getElements();};
+    public: PlugMap::Elements getPlugs() const {return _plugMap.getElements();};
     public: Plugs getConnectedPlugs() const;
     public: Plugs getUnconnectedPlugs() const;
     public: Path getPath(const Path& tailPath = Path()) const;
@@ -38,7 +38,7 @@ template<class Key, class Element> class IntrusiveMap {
 // Types
 // *****
 
-    class Elements : public Collection<Element*> {
+    public: class Elements : public Collection<Element*> {
     // *****************************************
         
     // Types
@@ -169,6 +169,52 @@ template<class Key, class Element> class IntrusiveMap {
     
         };
     
+    // Iterator
+    // ********
+    // Stack allocated, non virtual iterator used by range-for loops run
+    // directly on Elements: no Collection clone nor Locator allocation.
+
+        public: class iterator {
+        // *********************
+
+            public: iterator(const IntrusiveMap* map = NULL)
+            // *********************************************
+            :    _map(map),
+                _index(0),
+                _element(NULL)
+            {
+                if (_map) {
+                    unsigned length = _map->_getLength();
+                    do {
+                        _element = _map->_getArray()[_index++];
+                    } while (!_element && (_index < length));
+                }
+            };
+
+            public: Element* operator*() const { return _element; };
+            public: bool operator==(const iterator& other) const { return (_element == other._element); };
+            public: bool operator!=(const iterator& other) const { return (_element != other._element); };
+
+            public: iterator& operator++()
+            // ***************************
+            {
+                if (_element) {
+                    _element = _map->_getNextElement(_element);
+                    if (!_element) {
+                        unsigned length = _map->_getLength();
+                        while (!_element && (_index < length))
+                            _element = _map->_getArray()[_index++];
+                    }
+                }
+                return *this;
+            };
+
+            private: const IntrusiveMap* _map;
+            private: unsigned _index;
+            private: Element* _element;
+
+        };
+
     // Attributes
     // **********
     
@@ -215,6 +261,9 @@ template<class Key, class Element> class IntrusiveMap {
         {
             return new Locator(_map);
         };
+
+        public: iterator begin() const { return iterator(_map); };
+        public: iterator end() const { return iterator(); };
     
     // Others
     // ******
@@ -520,7 +569,7 @@ template<class Key, class Element> class IntrusiveMapConst {
 // Types
 // *****
 
-    class Elements : public Collection<Element*> {
+    public: class Elements : public Collection<Element*> {
     // *****************************************
         
     // Types
@@ -651,6 +700,52 @@ template<class Key, class Element> class IntrusiveMapConst {
     
         };
     
+    // Iterator
+    // ********
+    // Stack allocated, non virtual iterator used by range-for loops run
+    // directly on Elements: no Collection clone nor Locator allocation.
+
+        public: class iterator {
+        // *********************
+
+            public: iterator(const IntrusiveMapConst* map = NULL)
+            // **************************************************
+            :    _map(map),
+                _index(0),
+                _element(NULL)
+            {
+                if (_map) {
+                    unsigned length = _map->_getLength();
+                    do {
+                        _element = _map->_getArray()[_index++];
+                    } while (!_element && (_index < length));
+                }
+            };
+
+            public: Element* operator*() const { return _element; };
+            public: bool operator==(const iterator& other) const { return (_element == other._element); };
+            public: bool operator!=(const iterator& other) const { return (_element != other._element); };
+
+            public: iterator& operator++()
+            // ***************************
+            {
+                if (_element) {
+                    _element = _map->_getNextElement(_element);
+                    if (!_element) {
+                        unsigned length = _map->_getLength();
+                        while (!_element && (_index < length))
+                            _element = _map->_getArray()[_index++];
+                    }
+                }
+                return *this;
+            };
+
+            private: const IntrusiveMapConst* _map;
+            private: unsigned _index;
+            private: Element* _element;
+
+        };
+
     // Attributes
     // **********
     
@@ -697,6 +792,9 @@ template<class Key, class Element> class IntrusiveMapConst {
         {
             return new Locator(_map);
         };
+
+        public: iterator begin() const { return iterator(_map); };
+        public: iterator end() const { return iterator(); };
     
     // Others
     // ******
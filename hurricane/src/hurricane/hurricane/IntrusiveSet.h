@@ -38,7 +38,7 @@ template<class Element> class IntrusiveSet {
 // Types
 // *****
 
-    class Elements : public Collection<Element*> {
+    public: class Elements : public Collection<Element*> {
     // *****************************************
         
     // Types
@@ -163,6 +163,52 @@ template<class Element> class IntrusiveSet {
     
         };
     
+    // Iterator
+    // ********
+    // Stack allocated, non virtual iterator used by range-for loops run
+    // directly on Elements: no Collection clone nor Locator allocation.
+
+        public: class iterator {
+        // *********************
+
+            public: iterator(const IntrusiveSet* set = NULL)
+            // *********************************************
+            :    _set(set),
+                _index(0),
+                _element(NULL)
+            {
+                if (_set) {
+                    unsigned length = _set->_getLength();
+                    do {
+                        _element = _set->_getArray()[_index++];
+                    } while (!_element && (_index < length));
+                }
+            };
+
+            public: Element* operator*() const { return _element; };
+            public: bool operator==(const iterator& other) const { return (_element == other._element); };
+            public: bool operator!=(const iterator& other) const { return (_element != other._element); };
+
+            public: iterator& operator++()
+            // ***************************
+            {
+                if (_element) {
+                    _element = _set->_getNextElement(_element);
+                    if (!_element) {
+                        unsigned length = _set->_getLength();
+                        while (!_element && (_index < length))
+                            _element = _set->_getArray()[_index++];
+                    }
+                }
+                return *this;
+            };
+
+            private: const IntrusiveSet* _set;
+            private: unsigned _index;
+            private: Element* _element;
+
+        };
+
     // Attributes
     // **********
     
@@ -209,6 +255,9 @@ template<class Element> class IntrusiveSet {
         {
             return new Locator(_set);
         };
+
+        public: iterator begin() const { return iterator(_set); };
+        public: iterator end() const { return iterator(); };
     
     // Others
     // ******
@@ -179,7 +179,7 @@ class Net : public Entity {
     public: const Point& getPosition() const {return _position;};
     public: const DbU::Unit& getX() const {return _position.getX();};
     public: const DbU::Unit& getY() const {return _position.getY();};
-    public: Components getComponents() const {return _componentSet.getElements();};
+    public: ComponentSet::Elements getComponents() const {return _componentSet.getElements();};
     public: Rubbers getRubbers() const {return _rubberSet.getElements();};
     public: RoutingPads getRoutingPads() const;
     public: Plugs getPlugs() const;
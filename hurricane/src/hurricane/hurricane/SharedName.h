@@ -40,21 +40,24 @@ namespace Hurricane {
              string         _getString   () const;
              Record*        _getRecord   () const;
     private:               
-                            SharedName   ( const string& );
+                            SharedName   ( const string&, unsigned long hash );
                             SharedName   ( const SharedName& );
                            ~SharedName   ();
              SharedName&    operator=    ( const SharedName& );
              void           capture      ();
              void           release      ();
+      static SharedName*    _get         ( const string& );
+      static unsigned long  _computeHash ( const string& );
+      static size_t         _getSlot     ( unsigned long hash );
+      static void           _insert      ( SharedName* );
+      static void           _erase       ( SharedName* );
+      static void           _resize      ( size_t );
 
     private:
-      struct SharedNameMapComparator {
-          bool operator() ( string* lhs, string* rhs ) const;
-      };
-      typedef  map<string*, SharedName*, SharedNameMapComparator>  SharedNameMap;
-
-    private:
-      static SharedNameMap* _SHARED_NAME_MAP;
+    // Open addressed (linear probing) table, indexed by _hash.
+      static SharedName**   _SHARED_NAME_TABLE;
+      static size_t         _tableBits;
+      static size_t         _tableCount;
              unsigned long  _hash;
              int            _count;
              string         _string;
@@ -64,6 +64,7 @@ namespace Katana {
 
     if (Cfg::getParamBool("katana.useGlobalEstimate"    ,false)->asBool()) _flags |= UseGlobalEstimate;
     if (Cfg::getParamBool("katana.useStaticBloatProfile",true )->asBool()) _flags |= UseStaticBloatProfile;
+    if (Cfg::getParamBool("katana.useAStar"             ,false)->asBool()) _flags |= UseAStar;
 
     // for ( size_t i=0 ; i<MaxMetalDepth ; ++i ) {
     //   ostringstream paramName;
@@ -179,6 +180,7 @@ namespace Katana {
     cout << Dots::asUInt  ("     - Dijkstra GR search halo"            ,getSearchHalo()) << endl;
     cout << Dots::asBool  ("     - Use GR density estimate"            ,useGlobalEstimate()) << endl;
     cout << Dots::asBool  ("     - Use static bloat profile"           ,useStaticBloatProfile()) << endl;
+    cout << Dots::asBool  ("     - Use A* for Dijkstra GR"             ,useAStar()) << endl;
     cout << Dots::asDouble("     - GCell saturate ratio (LA)"          ,getSaturateRatio()) << endl;
     cout << Dots::asUInt  ("     - Edge max H reserved local"          ,_hTracksReservedLocal) << endl;
     cout << Dots::asUInt  ("     - Edge max V reserved local"          ,_vTracksReservedLocal) << endl;
@@ -42,6 +42,17 @@ namespace Katana {
 // Class  :  "DataNegociate".
 
 
+  ObjectPool  DataNegociate::_pool ( "DataNegociate", sizeof(DataNegociate) );
+
+
+  void* DataNegociate::operator new ( size_t size )
+  { return _pool.allocate( size ); }
+
+
+  void  DataNegociate::operator delete ( void* object )
+  { _pool.deallocate( object ); }
+
+
   DataNegociate::DataNegociate ( TrackElement* trackSegment )
     : _trackSegment     (trackSegment)
     , _childSegment     (NULL)
@@ -41,6 +41,8 @@ namespace {
   using std::left;
   using std::right;
   using std::set;
+  using std::map;
+  using std::vector;
   using Hurricane::DbU;
   using Hurricane::Interval;
   using Hurricane::DBo;
@@ -52,6 +54,7 @@ namespace {
   using Anabatic::GCell;
   using Anabatic::Vertex;
   using Anabatic::AnabaticEngine;
+  using Anabatic::NetData;
   using Etesian::BloatExtension;
   using namespace Katana;
 
@@ -60,6 +63,7 @@ namespace {
     public:
       inline            DigitalDistance ( float h, float k, float hScaling );
       inline void       setNet          ( Net* );
+      inline float      getMinUnitCost  () const;
              DbU::Unit  operator()      ( const Vertex* source ,const Vertex* target,const Edge* edge ) const;
     private:
     // For an explanation of h & k parameters, see:
@@ -75,6 +79,14 @@ namespace {
   inline void  DigitalDistance::setNet          ( Net* net ) { _net = net; }
 
 
+// Lower bound of the cost of one unit of length, whatever the edge
+// congestion, historic cost or direction (A* estimate scaling).
+// Does not hold in channel mode, where a saturated edge into an already
+// connected standard cell row costs nothing, so A* is disabled there.
+  inline float  DigitalDistance::getMinUnitCost () const
+  { return std::min( 1.0f, _hScaling ) * std::min( 1.0f, 1.0f+_h ); }
+
+
   DbU::Unit  DigitalDistance::operator() ( const Vertex* source, const Vertex* target, const Edge* edge ) const
   {
     if (source->getGCell()->isStdCellRow() and target->getGCell()->isStdCellRow())
@@ -155,6 +167,113 @@ namespace {
   }
 
 
+// -------------------------------------------------------------------
+// Class  :  "GlobalLengths".
+//
+// Keep the wirelength & VIA count of each globally routed net, so the
+// totals are updated only for the nets that are (re)routed.
+
+  class GlobalLengths {
+    public:
+                       GlobalLengths  ( KatanaEngine* );
+             void      update         ( NetData* );
+             long      getWireLength  () const;
+      inline long      getViaCount    () const;
+    private:
+      struct NetLength {
+        DbU::Unit  hWireLength;
+        DbU::Unit  vWireLength;
+        long       viaCount;
+      };
+    private:
+      KatanaEngine*            _katana;
+      map<NetData*,NetLength>  _netLengths;
+      DbU::Unit                _hWireLength;
+      DbU::Unit                _vWireLength;
+      long                     _viaCount;
+  };
+
+
+  GlobalLengths::GlobalLengths ( KatanaEngine* katana )
+    : _katana     (katana)
+    , _netLengths ()
+    , _hWireLength(0)
+    , _vWireLength(0)
+    , _viaCount   (0)
+  {
+    for ( NetData* netData : katana->getNetOrdering() ) {
+      if (netData->isGlobalRouted()) update( netData );
+    }
+  }
+
+
+  void  GlobalLengths::update ( NetData* netData )
+  {
+    auto ilength = _netLengths.find( netData );
+    if (ilength != _netLengths.end()) {
+      _hWireLength -= (*ilength).second.hWireLength;
+      _vWireLength -= (*ilength).second.vWireLength;
+      _viaCount    -= (*ilength).second.viaCount;
+      _netLengths.erase( ilength );
+    }
+    if (not netData->isGlobalRouted()) return;
+
+    NetLength length = { 0, 0, 0 };
+    _katana->computeGlobalWireLength( netData, length.hWireLength, length.vWireLength, length.viaCount );
+    _netLengths.insert( make_pair(netData,length) );
+
+    _hWireLength += length.hWireLength;
+    _vWireLength += length.vWireLength;
+    _viaCount    += length.viaCount;
+  }
+
+
+  long  GlobalLengths::getWireLength () const
+  { return _hWireLength / GCell::getMatrixHSide() + _vWireLength / GCell::getMatrixVSide(); }
+
+
+  inline long  GlobalLengths::getViaCount () const { return _viaCount; }
+
+
+// -------------------------------------------------------------------
+// Class  :  "RankOrder".
+//
+// Sort nets according to their position in the global net ordering.
+// The ranks are looked up once per net before sorting, not at each
+// comparison.
+
+  class RankOrder {
+    public:
+                    RankOrder  ( const vector<NetData*>& );
+             void   sort       ( vector<NetData*>& ) const;
+    private:
+      map<NetData*,size_t>  _ranks;
+  };
+
+
+  RankOrder::RankOrder ( const vector<NetData*>& ordering )
+    : _ranks()
+  {
+    for ( size_t i=0 ; i<ordering.size() ; ++i ) _ranks.insert( make_pair(ordering[i],i) );
+  }
+
+
+  void  RankOrder::sort ( vector<NetData*>& nets ) const
+  {
+    vector< pair<size_t,NetData*> >  rankeds;
+    rankeds.reserve( nets.size() );
+    for ( NetData* netData : nets ) {
+      auto irank = _ranks.find( netData );
+      rankeds.push_back( make_pair( (irank != _ranks.end()) ? (*irank).second : _ranks.size(), netData ) );
+    }
+
+    std::stable_sort( rankeds.begin(), rankeds.end()
+                    , [] ( const pair<size_t,NetData*>& lhs, const pair<size_t,NetData*>& rhs )
+                         { return lhs.first < rhs.first; } );
+    for ( size_t i=0 ; i<rankeds.size() ; ++i ) nets[i] = rankeds[i].second;
+  }
+
+
   void  computeNextHCost ( Edge* edge, float edgeHInc )
   {
     float congestion = (float)edge->getRealOccupancy() / (float)edge->getCapacity();
@@ -450,9 +569,9 @@ namespace Katana {
         updateEstimateDensityOfPath( this, targets[0], targets[1], weight );
         return;
       default:
-        { int      accuracy = 3;
-          int64_t* xs       = new int64_t [targets.size()];
-          int64_t* ys       = new int64_t [targets.size()];
+        { int              accuracy = 3;
+          vector<int64_t>  xs       ( targets.size() );
+          vector<int64_t>  ys       ( targets.size() );
 
           for ( size_t itarget=0 ; itarget<targets.size() ; ++itarget ) {
             Point center =  targets[itarget]->getCenter();
@@ -460,7 +579,7 @@ namespace Katana {
             ys[ itarget ] = center.getY();
           }
 
-          Flute::Tree tree = Flute::flute( targets.size(), xs, ys, accuracy );
+          Flute::Tree tree = Flute::flute( targets.size(), xs.data(), ys.data(), accuracy );
 
           for ( size_t i=0 ; (int)i < 2*tree.deg - 2 ; ++i ) {
             size_t j = tree.branch[i].n;
@@ -486,6 +605,7 @@ namespace Katana {
 
             updateEstimateDensityOfPath( this, source, target, weight );
           }
+          free( tree.branch );
         }
         return;
     }
@@ -523,18 +643,32 @@ namespace Katana {
     else
       dijkstra->setSearchAreaHalo( Session::getSliceHeight()*getSearchHalo() );
 
-    bool     globalEstimated = false;
-    size_t   iteration       = 0;
-    size_t   netCount        = 0;
-    uint64_t edgeOverflowWL  = 0;
+    Dijkstra::Mode dijkstraMode = Dijkstra::Mode::Standart;
+    if (useAStar() and not isChannelMode()) {
+      dijkstraMode |= Dijkstra::Mode::AStar;
+      dijkstra->setEstimateScaling( distance->getMinUnitCost() );
+    }
+
+    bool             globalEstimated = false;
+    size_t           iteration       = 0;
+    size_t           netCount        = 0;
+    uint64_t         edgeOverflowWL  = 0;
+    uint64_t         totalExpandeds  = 0;
+    uint64_t         totalRouteds    = 0;
+    GlobalLengths    lengths         ( this );
+    RankOrder        rankOrder       ( getNetOrdering() );
+    vector<NetData*> netQueue        ( getNetOrdering() );
+
+  // After the first iteration, only the nets ripped up by the previous
+  // one are rerouted (in the net ordering), instead of walking all of them.
+    clearRipupNets();
     do {
       cmess2 << "     [" << setfill(' ') << setw(3) << iteration << "] nets:";
 
-      long   wireLength = 0;
-      long   viaCount   = 0;
+      uint64_t expandeds = 0;
 
       netCount = 0;
-      for ( NetData* netData : getNetOrdering() ) {
+      for ( NetData* netData : netQueue ) {
         if (netData->isGlobalRouted() or netData->isExcluded()) continue;
         if (netData->isGlobalEstimated()) {
           updateEstimateDensity( netData, -1.0 );
@@ -543,8 +677,10 @@ namespace Katana {
 
         distance->setNet( netData->getNet() );
         dijkstra->load( netData->getNet() );
-        dijkstra->run();
+        dijkstra->run( dijkstraMode );
         netData->setGlobalRouted( true );
+        expandeds += dijkstra->getExpandedCount();
+        lengths.update( netData );
         ++netCount;
 
         // if (netData->getNet()->getName() == Name("mips_r3000_1m_dp_shift32_rshift_se_msb")) {
@@ -569,10 +705,12 @@ namespace Katana {
         }
       }
       cmess2 << left << setw(6) << netCount;
+      cmess2 << " exp/net:" << setw(5) << ((netCount) ? expandeds/netCount : 0);
+      totalExpandeds += expandeds;
+      totalRouteds   += netCount;
 
-      computeGlobalWireLength( wireLength, viaCount );
-      cmess2 <<  " nWL:" << setw(7) << (wireLength /*+ viaCount*3*/);
-      cmess2 << " VIAs:" << setw(7) << viaCount;
+      cmess2 <<  " nWL:" << setw(7) << lengths.getWireLength();
+      cmess2 << " VIAs:" << setw(7) << lengths.getViaCount();
 
       size_t overflow = ovEdges.size();
       for ( Edge* edge : ovEdges ) {
@@ -609,6 +747,10 @@ namespace Katana {
         dijkstra->setSearchAreaHalo( (getSearchHalo() + 3*(iteration/3)) * Session::getSliceHeight() );
       }
 
+      netQueue = getRipupNets();
+      clearRipupNets();
+      rankOrder.sort( netQueue );
+
       cmess2 << " ovE:" << setw(4) << overflow << " ovWL:" << setw(5) << edgeOverflowWL;
 
       cmess2 << " ripup:" << setw(4) << netCount << right;
@@ -622,6 +764,8 @@ namespace Katana {
 
     stopMeasures();
     printMeasures( "Dijkstra" );
+    cmess2 << ::Dots::asULong( "     - Expanded vertexes per net"
+                             , (totalRouteds) ? totalExpandeds/totalRouteds : 0 ) << endl;
 
     if (not ovEdges.empty()) {
       Histogram  ovHistogram ( 0.0, 1.0, 1 );
@@ -722,42 +866,50 @@ namespace Katana {
 
   void  KatanaEngine::computeGlobalWireLength ( long& wireLength, long& viaCount )
   {
-    const Layer* hLayer = getConfiguration()->getGHorizontalLayer();
-    const Layer* vLayer = getConfiguration()->getGVerticalLayer();
-    const Layer* cLayer = getConfiguration()->getGContactLayer();
-
     DbU::Unit hWireLength = 0;
     DbU::Unit vWireLength = 0;
 
     for ( NetData* netData : getNetOrdering() ) {
       if (not netData->isGlobalRouted()) continue;
+      computeGlobalWireLength( netData, hWireLength, vWireLength, viaCount );
+    }
+
+    wireLength  = hWireLength / GCell::getMatrixHSide();
+    wireLength += vWireLength / GCell::getMatrixVSide();
+  }
+
+
+  void  KatanaEngine::computeGlobalWireLength ( NetData*   netData
+                                              , DbU::Unit& hWireLength
+                                              , DbU::Unit& vWireLength
+                                              , long&      viaCount )
+  {
+    const Layer* hLayer = getConfiguration()->getGHorizontalLayer();
+    const Layer* vLayer = getConfiguration()->getGVerticalLayer();
+    const Layer* cLayer = getConfiguration()->getGContactLayer();
 
-      for ( Component* component : netData->getNet()->getComponents() ) {
-        if (component->getLayer() == hLayer) {
-          hWireLength += static_cast<Horizontal*>( component )->getLength();
+    for ( Component* component : netData->getNet()->getComponents() ) {
+      if (component->getLayer() == hLayer) {
+        hWireLength += static_cast<Horizontal*>( component )->getLength();
+      } else {
+        if (component->getLayer() == vLayer) {
+          vWireLength += static_cast<Vertical*>( component )->getLength();
         } else {
-          if (component->getLayer() == vLayer) {
-            vWireLength += static_cast<Vertical*>( component )->getLength();
-          } else {
-            if (component->getLayer() == cLayer) {
-              Contact* contact = static_cast<Contact*>( component );
-            //size_t   gslaves = 0;
-
-              for ( Component* slave : contact->getSlaveComponents().getSubSet<Segment*>() ) {
-                if (slave->getLayer() == vLayer) { ++viaCount; break; }
-                // if (slave->getLayer() == hLayer) {
-                //   ++gslaves;
-                //   if (gslaves >= 2) { ++viaCount; break; }
-                // }
-              }
+          if (component->getLayer() == cLayer) {
+            Contact* contact = static_cast<Contact*>( component );
+          //size_t   gslaves = 0;
+
+            for ( Component* slave : contact->getSlaveComponents().getSubSet<Segment*>() ) {
+              if (slave->getLayer() == vLayer) { ++viaCount; break; }
+              // if (slave->getLayer() == hLayer) {
+              //   ++gslaves;
+              //   if (gslaves >= 2) { ++viaCount; break; }
+              // }
             }
           }
         }
       }
     }
-
-    wireLength  = hWireLength / GCell::getMatrixHSide();
-    wireLength += vWireLength / GCell::getMatrixVSide();
   }
 
 
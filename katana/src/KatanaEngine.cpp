@@ -891,6 +891,8 @@ namespace Katana {
       }
 
       Session::close();
+    // Every TrackSegment, DataNegociate & RoutingEvent is destroyed by now.
+      ObjectPool::releaseAll();
     }
 
     cdebug_tabw(155,-1);
@@ -923,9 +925,11 @@ namespace Katana {
     }
 
     setState( Anabatic::EngineCreation );
+    clearRipupNets();
     setGlobalRoutingSuccess  ( false );
     setDetailedRoutingSuccess( false );
     UpdateSession::close();
+    ObjectPool::releaseAll();
     
     getCell()->resetFlags( Cell::Flags::Routed );
   }
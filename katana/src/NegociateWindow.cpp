@@ -23,6 +23,7 @@
 #include "hurricane/UpdateSession.h"
 #include "hurricane/Warning.h"
 #include "hurricane/Bug.h"
+#include "hurricane/Timer.h"
 #include "hurricane/RoutingPad.h"
 #include "hurricane/Net.h"
 #include "hurricane/Cell.h"
@@ -239,6 +240,7 @@ namespace Katana {
   using Hurricane::Breakpoint;
   using Hurricane::Warning;
   using Hurricane::Bug;
+  using Hurricane::Timer;
   using Hurricane::tab;
   using Hurricane::ForEachIterator;
   using Hurricane::DebugSession;
@@ -569,6 +571,10 @@ namespace Katana {
 
     if (profiling) ofprofile.open( "katana.profile.txt" );
 
+    Timer timer;
+    timer.start();
+    size_t processedsStart = RoutingEvent::getProcesseds();
+
     _eventHistory.clear();
     _eventQueue.load( _segments );
     cmess2 << "        <queue:" <<  right << setw(8) << setfill('0') << _eventQueue.size() << ">" << endl;
@@ -728,7 +734,10 @@ namespace Katana {
     }
 
     if (ofprofile.is_open()) ofprofile.close();
-    _statistics.setEventsCount( eventsCount );
+    timer.stop();
+    _statistics.setEventsCount    ( eventsCount );
+    _statistics.setProcessedsCount( RoutingEvent::getProcesseds() - processedsStart );
+    _statistics.setEventsTime     ( timer.getCombTime() );
     cdebug_tabw(159,-1);
 
     return eventsCount;
@@ -794,6 +803,10 @@ namespace Katana {
     cmess1 << Dots::asSizet("     - Unique Events Total"
                            ,(RoutingEvent::getProcesseds() - RoutingEvent::getCloneds())) << endl;
     cmess1 << Dots::asSizet("     - # of GCells",_statistics.getGCellsCount()) << endl;
+    if (_statistics.getEventsTime() > 0.0)
+      cmess1 << Dots::asDouble("     - Events per second"
+                              ,_statistics.getProcessedsCount() / _statistics.getEventsTime()) << endl;
+    ObjectPool::printStatistics();
     _katana->printCompletion();
 
     _katana->addMeasure<size_t>( "Events" , RoutingEvent::getProcesseds(), 12 );
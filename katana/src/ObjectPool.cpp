@@ -0,0 +1,142 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) UPMC 2008-2018, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :   "./ObjectPool.cpp"                             |
+// +-----------------------------------------------------------------+
+
+
+#include <new>
+#include <algorithm>
+#include "hurricane/Bug.h"
+#include "hurricane/Error.h"
+#include "crlcore/Utilities.h"
+#include "katana/ObjectPool.h"
+
+
+namespace Katana {
+
+  using std::cerr;
+  using std::endl;
+  using std::max;
+  using std::max_align_t;
+  using Hurricane::Bug;
+  using Hurricane::Error;
+
+
+// -------------------------------------------------------------------
+// Class  :  "ObjectPool".
+
+
+  vector<ObjectPool*>& ObjectPool::_getPools ()
+  {
+    static vector<ObjectPool*> pools;
+    return pools;
+  }
+
+
+  const vector<ObjectPool*>& ObjectPool::getPools ()
+  { return _getPools(); }
+
+
+  void  ObjectPool::releaseAll ()
+  {
+    for ( ObjectPool* pool : _getPools() ) {
+      if (not pool->release())
+        cerr << Bug( "ObjectPool::releaseAll(): Pool \"%s\" still has %zu live objects, chunks kept."
+                   , pool->getName(), pool->getLiveCount() ) << endl;
+    }
+  }
+
+
+  void  ObjectPool::printStatistics ()
+  {
+    for ( ObjectPool* pool : _getPools() ) {
+      cmess2 << Dots::asString( string("     - Pool ")+pool->getName()+" (live/peak)"
+                              , getString(pool->getLiveCount())+"/"+getString(pool->getPeakCount()) ) << endl;
+    }
+  }
+
+
+  ObjectPool::ObjectPool ( const char* name, size_t objectSize, size_t chunkSize )
+    : _name      (name)
+    , _objectSize(objectSize)
+    , _chunkSize (max( chunkSize, (size_t)1 ))
+    , _chunks    ()
+    , _freeSlots (NULL)
+    , _lives     (0)
+    , _peak      (0)
+  {
+    const size_t alignment = alignof(max_align_t);
+    _objectSize = max( _objectSize, sizeof(FreeSlot) );
+    _objectSize = ((_objectSize + alignment - 1) / alignment) * alignment;
+
+    _getPools().push_back( this );
+  }
+
+
+  ObjectPool::~ObjectPool ()
+  {
+    vector<ObjectPool*>& pools = _getPools();
+    pools.erase( std::remove( pools.begin(), pools.end(), this ), pools.end() );
+
+  // Objects still alive at exit time are leaked rather than left dangling.
+    release();
+  }
+
+
+  void* ObjectPool::allocate ( size_t size )
+  {
+    if (size > _objectSize)
+      throw Error( "ObjectPool::allocate(): Pool \"%s\" cannot allocate %zu bytes (slots of %zu)."
+                 , _name, size, _objectSize );
+
+    if (not _freeSlots) {
+      char* chunk = static_cast<char*>( ::operator new(_objectSize*_chunkSize) );
+      _chunks.push_back( chunk );
+
+      for ( size_t i=_chunkSize ; i>0 ; --i ) {
+        FreeSlot* slot = reinterpret_cast<FreeSlot*>( chunk + (i-1)*_objectSize );
+        slot->_next = _freeSlots;
+        _freeSlots  = slot;
+      }
+    }
+
+    FreeSlot* slot = _freeSlots;
+    _freeSlots = slot->_next;
+    _peak      = max( _peak, ++_lives );
+    return slot;
+  }
+
+
+  void  ObjectPool::deallocate ( void* object )
+  {
+    if (not object) return;
+
+    FreeSlot* slot = static_cast<FreeSlot*>( object );
+    slot->_next = _freeSlots;
+    _freeSlots  = slot;
+    --_lives;
+  }
+
+
+  bool  ObjectPool::release ()
+  {
+    if (_lives) return false;
+
+    for ( char* chunk : _chunks ) ::operator delete( chunk );
+    _chunks.clear();
+    _freeSlots = NULL;
+    return true;
+  }
+
+
+}  // Katana namespace.
@@ -178,6 +178,17 @@ namespace Katana {
   uint32_t  RoutingEvent::_cloneds    = 0;
 
 
+  ObjectPool  RoutingEvent::_pool ( "RoutingEvent", sizeof(RoutingEvent) );
+
+
+  void* RoutingEvent::operator new ( size_t size )
+  { return _pool.allocate( size ); }
+
+
+  void  RoutingEvent::operator delete ( void* object )
+  { _pool.deallocate( object ); }
+
+
   uint32_t  RoutingEvent::getStage        () { return Session::getStage(); }
   uint32_t  RoutingEvent::getAllocateds   () { return _allocateds; }
   uint32_t  RoutingEvent::getProcesseds   () { return _processeds; }
@@ -205,6 +216,7 @@ namespace Katana {
     , _insertState         (0)
     , _rippleState         (0)
     , _eventLevel          (0)
+    , _queueIndex          (std::numeric_limits<size_t>::max())
     , _key                 (this)
   {
     if (_idCounter == std::numeric_limits<uint32_t>::max()) {
@@ -252,6 +264,7 @@ namespace Katana {
     clone->_cloned     = false;
     clone->_disabled   = false;
     clone->_eventLevel = 0;
+    clone->_queueIndex = std::numeric_limits<size_t>::max();
 
     cdebug_log(159,0) << "RoutingEvent::clone() " << clone
                 << " (from: " << ")" <<  endl;
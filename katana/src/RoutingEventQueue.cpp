@@ -18,6 +18,7 @@
 #include <iomanip>
 #include <functional>
 #include <algorithm>
+#include <limits>
 #include "hurricane/Bug.h"
 #include "katana/DataNegociate.h"
 #include "katana/TrackSegment.h"
@@ -31,9 +32,8 @@ namespace Katana {
   using std::endl;
   using std::setw;
   using std::max;
-  using std::make_heap;
-  using std::push_heap;
-  using std::pop_heap;
+  using std::sort;
+  using std::numeric_limits;
 
   using Hurricane::tab;
   using Hurricane::Bug;
@@ -68,7 +68,8 @@ namespace Katana {
       }
       RoutingEvent* event = RoutingEvent::create( segments[i] );
       event->updateKey();
-      _events.insert( event );
+      _place( _events.size(), event );
+      _siftUp( event->_queueIndex );
     }
   }
 
@@ -93,24 +94,35 @@ namespace Katana {
 
     size_t addeds = _pushRequests.size();
     size_t before = _events.size();
+    size_t requeueds = 0;
 
     RoutingEventSet::iterator ipushEvent = _pushRequests.begin();
     for ( ; ipushEvent != _pushRequests.end() ; ipushEvent++ ) {
-      (*ipushEvent)->updateKey();
+      RoutingEvent* event = *ipushEvent;
+      event->updateKey();
+
+      _topEventLevel = max( _topEventLevel, event->getEventLevel() );
 
-      _topEventLevel = max( _topEventLevel, (*ipushEvent)->getEventLevel() );
-      _events.insert( (*ipushEvent) );
+    // An already queued event is only moved to match it's updated key.
+      if (_isQueued(event)) {
+        ++requeueds;
+        _siftUp  ( event->_queueIndex );
+        _siftDown( event->_queueIndex );
+      } else {
+        _place ( _events.size(), event );
+        _siftUp( event->_queueIndex );
+      }
 
-      cdebug_log(159,0) << "| " << (*ipushEvent) << endl;
+      cdebug_log(159,0) << "| " << event << endl;
     }
     _pushRequests.clear();
 #if defined(CHECK_ROUTINGEVENT_QUEUE)
     _keyCheck();
 #endif
     size_t after = _events.size();
-    if (after-before != addeds) {
+    if (after-before+requeueds != addeds) {
       cerr << Bug( "RoutingEventQueue::commit(): less than %d events pusheds (%d)."
-                 , addeds,(after-before) ) << endl;
+                 , addeds,(after-before+requeueds) ) << endl;
     }
 
     cdebug_tabw(159,-1);
@@ -119,7 +131,6 @@ namespace Katana {
 
   RoutingEvent* RoutingEventQueue::pop ()
   {
-    multiset<RoutingEvent*,RoutingEvent::Compare>::iterator ievent;
     RoutingEvent* event = NULL;
 
 #if defined(CHECK_ROUTINGEVENT_QUEUE)
@@ -127,19 +138,8 @@ namespace Katana {
 #endif
 
     if (not _events.empty()) {
-      size_t beforeSize = _events.size();
-
-      ievent = _events.end();
-      ievent--;
-      event  = (*ievent);
-      _events.erase( ievent );
-
-      size_t afterSize = _events.size();
-
-      if (afterSize+1 != beforeSize) {
-        cerr << Bug( "RoutingEventQueue::pop(): more than one event popped: %d."
-                   , (beforeSize-afterSize) ) << endl;
-      }
+      event = _events.front();
+      _remove( event );
     }
 
     return event;
@@ -152,18 +152,7 @@ namespace Katana {
     _keyCheck ();
 #endif
 
-    multiset<RoutingEvent*,RoutingEvent::Compare>::iterator ievent = _events.find(event);
-    size_t count = _events.count(event);
-    if (count > 1) {
-      cerr << Bug( "RoutingEventQueue::repush(): %d events matches key %p.", count, event ) << endl;
-#if defined(CHECK_ROUTINGEVENT_QUEUE)
-      _keyCheck ();
-#endif
-    }
-
-    if (ievent != _events.end()) {
-      _events.erase( ievent );
-    }
+    if (_isQueued(event)) _remove( event );
     push ( event );
   }
 
@@ -193,10 +182,8 @@ namespace Katana {
 
   void  RoutingEventQueue::prepareRepair ()
   {
-    multiset<RoutingEvent*,RoutingEvent::Compare>::const_iterator ievent = _events.begin ();
-    for ( ; ievent != _events.end(); ++ievent ) {
-      (*ievent)->getSegment()->base()->toOptimalAxis();
-    }
+    for ( RoutingEvent* event : _events )
+      event->getSegment()->base()->toOptimalAxis();
   }
 
 
@@ -206,14 +193,20 @@ namespace Katana {
       cerr << Bug("RoutingEvent queue is not empty, %d events remains."
                  ,_events.size()) << endl;
     }
+    for ( RoutingEvent* event : _events )
+      event->_queueIndex = numeric_limits<size_t>::max();
     _events.clear();
   }
 
 
   void  RoutingEventQueue::dump () const
   {
-    multiset<RoutingEvent*,RoutingEvent::Compare>::const_iterator ievent = _events.begin ();
-    for ( ; ievent != _events.end(); ievent++ ) {
+  // The heap is not sorted, dump a sorted copy (greatest, next popped, last).
+    vector<RoutingEvent*> events ( _events );
+    sort( events.begin(), events.end(), RoutingEvent::Compare() );
+
+    vector<RoutingEvent*>::const_iterator ievent = events.begin ();
+    for ( ; ievent != events.end(); ievent++ ) {
       cerr << "Deter| Queue:"
            <<         (*ievent)->getEventLevel()
            << ","  << setw(6) << (*ievent)->getPriority()
@@ -228,30 +221,83 @@ namespace Katana {
 
   void  RoutingEventQueue::_keyCheck () const
   {
-    multiset<RoutingEvent*,RoutingEvent::Compare>::const_iterator ievent = _events.begin ();
-    for ( ; ievent != _events.end(); ievent++ ) {
-      multiset<RoutingEvent*,RoutingEvent::Compare>::const_iterator ieventByKey
-        = _events.find ( *ievent );
-      
-      if ( ieventByKey != ievent ) {
-        if ( ieventByKey == _events.end() ) {
-          cerr << Bug("Key mismatch in RoutingEvent Queue:\n"
-                      "      %p:%s wasn't found by key."
-                     ,*ievent,getString(*ievent).c_str()
-                     ) << endl;
-        } else {
-          cerr << Bug("Key mismatch in RoutingEvent Queue:\n"
-                      "      %p:%s has same key of\n"
-                      "      %p:%s"
-                     ,*ievent,getString(*ievent).c_str()
-                     ,*ieventByKey,getString(*ieventByKey).c_str()
-                     ) << endl;
-        }
+    RoutingEvent::Compare compare;
+
+    for ( size_t i=0 ; i<_events.size() ; ++i ) {
+      if (_events[i]->_queueIndex != i) {
+        cerr << Bug("Index mismatch in RoutingEvent Queue:\n"
+                    "      %p:%s is at %d but records %d."
+                   ,_events[i],getString(_events[i]).c_str()
+                   ,i,_events[i]->_queueIndex
+                   ) << endl;
+      }
+      if (i and compare(_events[(i-1)/2],_events[i])) {
+        cerr << Bug("Key mismatch in RoutingEvent Queue:\n"
+                    "      %p:%s is greater than it's parent\n"
+                    "      %p:%s"
+                   ,_events[i],getString(_events[i]).c_str()
+                   ,_events[(i-1)/2],getString(_events[(i-1)/2]).c_str()
+                   ) << endl;
       }
     }
   }
 
 
+  void  RoutingEventQueue::_place ( size_t index, RoutingEvent* event )
+  {
+    if (index == _events.size()) _events.push_back( event );
+    else                         _events[index] = event;
+    event->_queueIndex = index;
+  }
+
+
+  void  RoutingEventQueue::_remove ( RoutingEvent* event )
+  {
+    size_t index = event->_queueIndex;
+    RoutingEvent* last = _events.back();
+    _events.pop_back();
+    event->_queueIndex = numeric_limits<size_t>::max();
+
+    if (last == event) return;
+    _place   ( index, last );
+    _siftUp  ( index );
+    _siftDown( last->_queueIndex );
+  }
+
+
+  void  RoutingEventQueue::_siftUp ( size_t index )
+  {
+    RoutingEvent::Compare compare;
+    RoutingEvent*         event = _events[index];
+
+    while ( index > 0 ) {
+      size_t parent = (index-1) / 2;
+      if (not compare(_events[parent],event)) break;
+      _place( index, _events[parent] );
+      index = parent;
+    }
+    _place( index, event );
+  }
+
+
+  void  RoutingEventQueue::_siftDown ( size_t index )
+  {
+    RoutingEvent::Compare compare;
+    RoutingEvent*         event = _events[index];
+    size_t                size  = _events.size();
+
+    while ( true ) {
+      size_t child = 2*index + 1;
+      if (child >= size) break;
+      if ((child+1 < size) and compare(_events[child],_events[child+1])) ++child;
+      if (not compare(event,_events[child])) break;
+      _place( index, _events[child] );
+      index = child;
+    }
+    _place( index, event );
+  }
+
+
   string  RoutingEventQueue::_getString () const
   {
     string s = "<" + _getTypeName();
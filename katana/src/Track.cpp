@@ -497,9 +497,8 @@ namespace Katana {
     getOccupiedInterval( begin );
 
     getBeginIndex( interval.getVMax(), end, iState );
-    for ( ; end < _segments.size() ; ++end ) {
-      if (_segments[end]->getSourceU() >= interval.getVMax()) break;
-    }
+    end = lower_bound( _segments.begin()+end, _segments.end(), interval.getVMax(), SourceCompare() )
+        - _segments.begin();
 
     cdebug_log(155,0) << "Track::getOverlapBounds(): begin:" << begin << " end:" << end << " AfterLastElement:" << (iState == AfterLastElement) << endl;
   }
@@ -567,33 +566,41 @@ namespace Katana {
       return cost;
     }
 
+  // The overlap is computed straight from the cached extremities, so
+  // getNet() (virtual) is only called on overlapping elements.
+    Net*                costNet       = cost.getNet();
+    const TrackElement* refElement    = cost.getRefElement();
+    const TrackElement* symElement    = cost.getSymElement();
+    bool                perpandicular = (refElement->getAxis() != getAxis());
+    DbU::Unit           vmin          = interval.getVMin();
+    DbU::Unit           vmax          = interval.getVMax();
+
     for ( ; begin < end ; begin++ ) {
-      Interval overlap = interval.getIntersection( _segments[begin]->getCanonicalInterval() );
-      cdebug_log(155,0) << "overlap:" << overlap
-                        << " size:" << DbU::getValueString(overlap.getSize()) << endl;
-      if (overlap.getSize() == 0) continue;
+      TrackElement* segment     = _segments[begin];
+      DbU::Unit     overlapSize = std::min( vmax, segment->getTargetU() )
+                                - std::max( vmin, segment->getSourceU() );
+      cdebug_log(155,0) << "overlap size:" << DbU::getValueString(overlapSize) << endl;
+      if (overlapSize <= 0) continue;
       
-      if (    (_segments[begin]->getNet() == cost.getNet())
-         and ((cost.getRefElement()->getAxis() != getAxis())
-             or not _segments[begin]->isNonPref() ) ) {
-        if (  (_segments[begin] == cost.getRefElement())
-           or (_segments[begin] == cost.getSymElement())) {
+      if (    (segment->getNet() == costNet)
+         and (perpandicular or not segment->isNonPref()) ) {
+        if ((segment == refElement) or (segment == symElement)) {
           cdebug_log(155,0) << "Segment istself in track, skip." << endl;
           continue;
         }
         if (     cost.doIgnoreShort()
-           and (_segments[begin]->getLength() < 2*_segments[begin]->getPPitch())) {
+           and (segment->getLength() < 2*segment->getPPitch())) {
           cdebug_log(155,0) << "Overlap with same net and less than one p-pitch, skip." << endl;
           continue;
         }
         cdebug_log(155,0) << "Same net overlap, increase delta shared ("
-                          <<            DbU::getValueString(_segments[begin]->getLength())
-                          << " > 2*" << DbU::getValueString(_segments[begin]->getPPitch())
+                          <<            DbU::getValueString(segment->getLength())
+                          << " > 2*" << DbU::getValueString(segment->getPPitch())
                           << ")" << endl;
-        cost.incDeltaShared ( overlap.getSize() );
+        cost.incDeltaShared ( overlapSize );
       }
-      _segments[begin]->incOverlapCost( cost );
-      cdebug_log(155,0) << "| overlap: " << _segments[begin] << endl;
+      segment->incOverlapCost( cost );
+      cdebug_log(155,0) << "| overlap: " << segment << endl;
       cdebug_log(155,0) << "| current cost:" << &cost << endl;
 
       if (cost.isInfinite()) break;
@@ -990,7 +997,35 @@ namespace Katana {
     cdebug_log(155,0) << "Track::doReorder() " << this << endl;
 
     if (not _segmentsValid) {
-      std::sort( _segments.begin(), _segments.end(), SegmentCompare() );
+    // Between two revalidations, only a few segments are inserted (at the
+    // end) or moved. Set them aside, sort them alone and merge them back
+    // into the still ordered part, instead of sorting the whole track.
+      SegmentCompare         compare;
+      vector<TrackElement*>  unordereds;
+      size_t                 kept = 0;
+
+      for ( size_t i=0 ; i<_segments.size() ; ++i ) {
+        TrackElement* segment = _segments[i];
+        bool          ordered = (kept == 0) or not compare( segment, _segments[kept-1] );
+
+      // A segment moved forward is detected by it's successor.
+        if (ordered and (i+1 < _segments.size())) {
+          TrackElement* next = _segments[i+1];
+          if (    compare(next,segment)
+             and ((kept == 0) or not compare(next,_segments[kept-1])) )
+            ordered = false;
+        }
+
+        if (ordered) _segments[kept++] = segment;
+        else         unordereds.push_back( segment );
+      }
+
+      if (not unordereds.empty()) {
+        std::sort( unordereds.begin(), unordereds.end(), compare );
+        _segments.resize( kept );
+        _segments.insert( _segments.end(), unordereds.begin(), unordereds.end() );
+        std::inplace_merge( _segments.begin(), _segments.begin()+kept, _segments.end(), compare );
+      }
       _segmentsValid = true;
     }
 
@@ -55,6 +55,17 @@ namespace Katana {
 // Class  :  "TrackSegmentNonPref".
 
 
+  ObjectPool  TrackSegmentNonPref::_pool ( "TrackSegmentNonPref", sizeof(TrackSegmentNonPref) );
+
+
+  void* TrackSegmentNonPref::operator new ( size_t size )
+  { return _pool.allocate( size ); }
+
+
+  void  TrackSegmentNonPref::operator delete ( void* object )
+  { _pool.deallocate( object ); }
+
+
   TrackSegmentNonPref::TrackSegmentNonPref ( AutoSegment* segment )
     : Super(segment,NULL)
     , _trackSpan (0)
@@ -51,6 +51,17 @@ namespace Katana {
 // Class  :  "TrackSegmentRegular".
 
 
+  ObjectPool  TrackSegmentRegular::_pool ( "TrackSegmentRegular", sizeof(TrackSegmentRegular) );
+
+
+  void* TrackSegmentRegular::operator new ( size_t size )
+  { return _pool.allocate( size ); }
+
+
+  void  TrackSegmentRegular::operator delete ( void* object )
+  { _pool.deallocate( object ); }
+
+
   TrackSegmentRegular::TrackSegmentRegular ( AutoSegment* segment, Track* track )
     : Super(segment,track)
   {
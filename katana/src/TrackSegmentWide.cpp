@@ -52,6 +52,17 @@ namespace Katana {
 // Class  :  "TrackSegmentWide".
 
 
+  ObjectPool  TrackSegmentWide::_pool ( "TrackSegmentWide", sizeof(TrackSegmentWide) );
+
+
+  void* TrackSegmentWide::operator new ( size_t size )
+  { return _pool.allocate( size ); }
+
+
+  void  TrackSegmentWide::operator delete ( void* object )
+  { _pool.deallocate( object ); }
+
+
   TrackSegmentWide::TrackSegmentWide ( AutoSegment* segment, Track* track, size_t trackSpan )
     : Super(segment,track)
     , _trackSpan (trackSpan)
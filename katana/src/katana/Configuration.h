@@ -54,6 +54,7 @@ namespace Katana {
       enum Flag        { UseClockTree          = (1 << 0)
                        , UseGlobalEstimate     = (1 << 1)
                        , UseStaticBloatProfile = (1 << 2)
+                       , UseAStar              = (1 << 3)
                        };
     public:
     // Constructor & Destructor.
@@ -64,6 +65,7 @@ namespace Katana {
       inline        bool                       useClockTree            () const;
       inline        bool                       useGlobalEstimate       () const;
       inline        bool                       useStaticBloatProfile   () const;
+      inline        bool                       useAStar                () const;
       inline        bool                       profileEventCosts       () const;
       inline        bool                       runRealignStage         () const;
     // Methods.                                                  
@@ -145,6 +147,7 @@ namespace Katana {
   inline       bool                          Configuration::useClockTree            () const { return _flags & UseClockTree; }
   inline       bool                          Configuration::useGlobalEstimate       () const { return _flags & UseGlobalEstimate; }
   inline       bool                          Configuration::useStaticBloatProfile   () const { return _flags & UseStaticBloatProfile; }
+  inline       bool                          Configuration::useAStar                () const { return _flags & UseAStar; }
   inline       bool                          Configuration::profileEventCosts       () const { return _profileEventCosts; }
   inline       bool                          Configuration::runRealignStage         () const { return _runRealignStage; }
   inline       void                          Configuration::setFlags                ( unsigned int flags ) { _flags |=  flags; }
@@ -23,6 +23,7 @@ namespace Hurricane {
 }
 
 #include  "katana/TrackElement.h"
+#include  "katana/ObjectPool.h"
 namespace Anabatic {
   class AutoSegment;
 }
@@ -61,6 +62,8 @@ namespace Katana {
                       , RepairFailed           = 12
                       };
     public:
+      static  void*                       operator new          ( size_t );
+      static  void                        operator delete       ( void* );
                                           DataNegociate         ( TrackElement* );
                                          ~DataNegociate         ();
       inline bool                         hasRoutingEvent       () const;
@@ -109,6 +112,8 @@ namespace Katana {
       vector<TrackElement*> _perpandiculars;
       Interval              _perpandicularFree;
       Interval              _reduceRanges[2];
+    private:
+      static  ObjectPool    _pool;
     private:
                              DataNegociate     ( const DataNegociate& );
               DataNegociate& operator=         ( const DataNegociate& );
@@ -79,6 +79,7 @@ namespace Katana {
       inline  bool                     useClockTree               () const;
       inline  bool                     useGlobalEstimate          () const;
       inline  bool                     useStaticBloatProfile      () const;
+      inline  bool                     useAStar                   () const;
       inline  CellViewer*              getViewer                  () const;
       inline  AnabaticEngine*          base                       ();
       inline  Configuration*           getKatanaConfiguration     ();
@@ -144,6 +145,7 @@ namespace Katana {
               void                     runNegociate               ( Flags flags=Flags::NoFlags );
               void                     runGlobalRouter            ( Flags flags=Flags::NoFlags );
               void                     computeGlobalWireLength    ( long& wireLength, long& viaCount );
+              void                     computeGlobalWireLength    ( NetData*, DbU::Unit& hWireLength, DbU::Unit& vWireLength, long& viaCount );
               void                     runTest                    ();
               void                     resetRouting               ();
       virtual void                     finalizeLayout             ();
@@ -197,6 +199,7 @@ namespace Katana {
   inline  bool                          KatanaEngine::useClockTree            () const { return _configuration->useClockTree(); }
   inline  bool                          KatanaEngine::useGlobalEstimate       () const { return _configuration->useGlobalEstimate(); }
   inline  bool                          KatanaEngine::useStaticBloatProfile   () const { return _configuration->useStaticBloatProfile(); }
+  inline  bool                          KatanaEngine::useAStar                () const { return _configuration->useAStar(); }
   inline  CellViewer*                   KatanaEngine::getViewer               () const { return _viewer; }
   inline  AnabaticEngine*               KatanaEngine::base                    () { return static_cast<AnabaticEngine*>(this); }
   inline  Configuration*                KatanaEngine::getKatanaConfiguration  () { return _configuration; }
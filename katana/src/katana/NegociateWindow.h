@@ -39,46 +39,60 @@ namespace Katana {
 
   class Statistics {
     public:
-      inline             Statistics       ();
-      inline size_t      getGCellsCount   () const;
-      inline size_t      getSegmentsCount () const;
-      inline size_t      getEventsCount   () const;
-      inline void        setGCellsCount   ( size_t );
-      inline void        setSegmentsCount ( size_t );
-      inline void        setEventsCount   ( size_t );
-      inline void        incGCellCount    ( size_t );
-      inline void        incSegmentsCount ( size_t );
-      inline void        incEventsCount   ( size_t );
-      inline Statistics& operator+=       ( const Statistics& );
+      inline             Statistics         ();
+      inline size_t      getGCellsCount     () const;
+      inline size_t      getSegmentsCount   () const;
+      inline size_t      getEventsCount     () const;
+      inline size_t      getProcessedsCount () const;
+      inline double      getEventsTime      () const;
+      inline void        setGCellsCount     ( size_t );
+      inline void        setSegmentsCount   ( size_t );
+      inline void        setEventsCount     ( size_t );
+      inline void        setProcessedsCount ( size_t );
+      inline void        setEventsTime      ( double );
+      inline void        incGCellCount      ( size_t );
+      inline void        incSegmentsCount   ( size_t );
+      inline void        incEventsCount     ( size_t );
+      inline Statistics& operator+=         ( const Statistics& );
     private:
       size_t  _gcellsCount;
       size_t  _segmentsCount;
       size_t  _eventsCount;
+      size_t  _processedsCount;
+      double  _eventsTime;
 
   };
 
 
   inline   Statistics::Statistics ()
-    : _gcellsCount   (0)
-    , _segmentsCount (0)
-    , _eventsCount   (0)
+    : _gcellsCount     (0)
+    , _segmentsCount   (0)
+    , _eventsCount     (0)
+    , _processedsCount (0)
+    , _eventsTime      (0.0)
   { }
 
-  inline size_t  Statistics::getGCellsCount   () const { return _gcellsCount; }
-  inline size_t  Statistics::getSegmentsCount () const { return _segmentsCount; }
-  inline size_t  Statistics::getEventsCount   () const { return _eventsCount; }
-  inline void    Statistics::setGCellsCount   ( size_t count ) { _gcellsCount = count; }
-  inline void    Statistics::setSegmentsCount ( size_t count ) { _segmentsCount = count; }
-  inline void    Statistics::setEventsCount   ( size_t count ) { _eventsCount = count; }
-  inline void    Statistics::incGCellCount    ( size_t count ) { _gcellsCount += count; }
-  inline void    Statistics::incSegmentsCount ( size_t count ) { _segmentsCount += count; }
-  inline void    Statistics::incEventsCount   ( size_t count ) { _eventsCount += count; }
+  inline size_t  Statistics::getGCellsCount     () const { return _gcellsCount; }
+  inline size_t  Statistics::getSegmentsCount   () const { return _segmentsCount; }
+  inline size_t  Statistics::getEventsCount     () const { return _eventsCount; }
+  inline size_t  Statistics::getProcessedsCount () const { return _processedsCount; }
+  inline double  Statistics::getEventsTime      () const { return _eventsTime; }
+  inline void    Statistics::setGCellsCount     ( size_t count ) { _gcellsCount = count; }
+  inline void    Statistics::setSegmentsCount   ( size_t count ) { _segmentsCount = count; }
+  inline void    Statistics::setEventsCount     ( size_t count ) { _eventsCount = count; }
+  inline void    Statistics::setProcessedsCount ( size_t count ) { _processedsCount = count; }
+  inline void    Statistics::setEventsTime      ( double time ) { _eventsTime = time; }
+  inline void    Statistics::incGCellCount      ( size_t count ) { _gcellsCount += count; }
+  inline void    Statistics::incSegmentsCount   ( size_t count ) { _segmentsCount += count; }
+  inline void    Statistics::incEventsCount     ( size_t count ) { _eventsCount += count; }
 
   inline Statistics& Statistics::operator+= ( const Statistics& other )
   {
-    _gcellsCount   += other._gcellsCount;
-    _segmentsCount += other._segmentsCount;
-    _eventsCount   += other._eventsCount;
+    _gcellsCount     += other._gcellsCount;
+    _segmentsCount   += other._segmentsCount;
+    _eventsCount     += other._eventsCount;
+    _processedsCount += other._processedsCount;
+    _eventsTime      += other._eventsTime;
     return *this;
   }
 
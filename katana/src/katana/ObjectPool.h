@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) UPMC 2008-2018, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :   "./katana/ObjectPool.h"                        |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace Katana {
+
+  using std::string;
+  using std::vector;
+
+
+// -------------------------------------------------------------------
+// Class  :  "ObjectPool".
+//
+// Fixed size object allocator, used through the class specific
+// operator new/delete of the hot Katana objects (TrackSegment variants,
+// DataNegociate and RoutingEvent). Objects are carved out of large
+// chunks and recycled through a free list. Chunks are given back to
+// the system only when no object of the pool is alive: by releaseAll()
+// once the engine is gutted, and by the pool destructor at exit.
+
+  class ObjectPool {
+    public:
+      static  const vector<ObjectPool*>& getPools        ();
+      static  void                       releaseAll      ();
+      static  void                       printStatistics ();
+    public:
+                                         ObjectPool      ( const char* name, size_t objectSize, size_t chunkSize=4096 );
+                                        ~ObjectPool      ();
+      inline  const char*                getName         () const;
+      inline  size_t                     getObjectSize   () const;
+      inline  size_t                     getLiveCount    () const;
+      inline  size_t                     getPeakCount    () const;
+      inline  size_t                     getChunksCount  () const;
+              void*                      allocate        ( size_t );
+              void                       deallocate      ( void* );
+              bool                       release         ();
+    private:
+      struct FreeSlot { FreeSlot* _next; };
+    private:
+      static  vector<ObjectPool*>&       _getPools       ();
+    private:
+      const char*    _name;
+      size_t         _objectSize;
+      size_t         _chunkSize;
+      vector<char*>  _chunks;
+      FreeSlot*      _freeSlots;
+      size_t         _lives;
+      size_t         _peak;
+    private:
+                                         ObjectPool      ( const ObjectPool& ) = delete;
+              ObjectPool&                operator=       ( const ObjectPool& ) = delete;
+  };
+
+
+  inline const char* ObjectPool::getName        () const { return _name; }
+  inline size_t      ObjectPool::getObjectSize  () const { return _objectSize; }
+  inline size_t      ObjectPool::getLiveCount   () const { return _lives; }
+  inline size_t      ObjectPool::getPeakCount   () const { return _peak; }
+  inline size_t      ObjectPool::getChunksCount () const { return _chunks.size(); }
+
+
+}  // Katana namespace.
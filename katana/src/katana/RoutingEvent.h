@@ -28,6 +28,7 @@ namespace Hurricane {
 #include "katana/TrackCost.h"
 #include "katana/TrackElement.h"
 #include "katana/DataNegociate.h"
+#include "katana/ObjectPool.h"
 #include "katana/Session.h"
 
 
@@ -90,6 +91,7 @@ namespace Katana {
           inline bool  operator() ( const RoutingEvent* lhs, const RoutingEvent* rhs ) const;
       };
     friend class Compare;
+    friend class RoutingEventQueue;
 
     public:
       static  uint32_t                     getStage              ();
@@ -98,6 +100,8 @@ namespace Katana {
       static  uint32_t                     getCloneds            ();
       static  void                         resetProcesseds       ();
     public:                                                      
+      static  void*                        operator new          ( size_t );
+      static  void                         operator delete       ( void* );
       static  RoutingEvent*                create                ( TrackElement* );
               RoutingEvent*                clone                 () const;
               void                         destroy               ();
@@ -171,6 +175,7 @@ namespace Katana {
       static uint32_t       _allocateds;
       static uint32_t       _processeds;
       static uint32_t       _cloneds;
+      static ObjectPool     _pool;
       mutable bool          _cloned;
       bool                  _processed;
       bool                  _disabled;
@@ -192,6 +197,7 @@ namespace Katana {
       unsigned int          _insertState     : 6;
       unsigned int          _rippleState     : 4;
       uint32_t              _eventLevel;
+      size_t                _queueIndex;
     //vector<TrackElement*> _perpandiculars;
       Key                   _key;
   };
@@ -25,7 +25,6 @@
 namespace Katana {
 
   using std::set;
-  using std::multiset;
   using std::vector;
 
 
@@ -51,15 +50,22 @@ namespace Katana {
               void          clear              ();
               void          dump               () const;
               void          _keyCheck          () const;
+    private:
+      inline  bool          _isQueued          ( const RoutingEvent* ) const;
+              void          _place             ( size_t, RoutingEvent* );
+              void          _remove            ( RoutingEvent* );
+              void          _siftUp            ( size_t );
+              void          _siftDown          ( size_t );
+    public:
               Record*       _getRecord         () const;
               string        _getString         () const;
       inline  string        _getTypeName       () const;
 
     protected:
     // Attributes.
-      uint32_t                                       _topEventLevel;
-      RoutingEventSet                                _pushRequests;
-      multiset<RoutingEvent*,RoutingEvent::Compare>  _events;
+      uint32_t               _topEventLevel;
+      RoutingEventSet        _pushRequests;
+      vector<RoutingEvent*>  _events;  // Binary max-heap over RoutingEvent::Compare.
 
     private:
               RoutingEventQueue& operator=         ( const RoutingEventQueue& );
@@ -75,6 +81,9 @@ namespace Katana {
   inline string    RoutingEventQueue::_getTypeName     () const { return "EventQueue"; }
   inline void      RoutingEventQueue::push             ( RoutingEvent* event ) { _pushRequests.insert( event ); }
 
+  inline bool  RoutingEventQueue::_isQueued ( const RoutingEvent* event ) const
+  { return (event->_queueIndex < _events.size()) and (_events[event->_queueIndex] == event); }
+
 
 }  // Katana namespace.
 
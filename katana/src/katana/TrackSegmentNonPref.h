@@ -20,6 +20,7 @@
 #include <set>
 #include <functional>
 #include "katana/TrackSegment.h"
+#include "katana/ObjectPool.h"
 
 
 namespace Katana {
@@ -47,6 +48,8 @@ namespace Katana {
       friend class TrackSegment;
     public:
       typedef  TrackSegment  Super;
+      static  void*                operator new    ( size_t );
+      static  void                 operator delete ( void* );
     protected:
                                    TrackSegmentNonPref ( AutoSegment* ) ;
       virtual                     ~TrackSegmentNonPref ();
@@ -65,6 +68,8 @@ namespace Katana {
     private:
       size_t    _trackSpan;
       uint32_t  _trackCount;
+    private:
+      static  ObjectPool  _pool;
   };
 
 
@@ -20,6 +20,7 @@
 #include <set>
 #include <functional>
 #include "katana/TrackSegment.h"
+#include "katana/ObjectPool.h"
 
 
 namespace Katana {
@@ -47,6 +48,8 @@ namespace Katana {
       friend class TrackSegment;
     public:
       typedef  TrackSegment  Super;
+      static  void*                operator new    ( size_t );
+      static  void                 operator delete ( void* );
     protected:
                                    TrackSegmentRegular ( AutoSegment*, Track* ) ;
       virtual                     ~TrackSegmentRegular ();
@@ -57,6 +60,8 @@ namespace Katana {
     private:
                                    TrackSegmentRegular ( const TrackSegmentRegular& ) = delete;
               TrackSegmentRegular& operator=           ( const TrackSegmentRegular& ) = delete;
+    private:
+      static  ObjectPool  _pool;
   };
 
 
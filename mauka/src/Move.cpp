@@ -141,16 +141,28 @@ static const unsigned	NetSrc		= 1;
 static const unsigned	NetDst		= 2;
 static const unsigned	NetSrcDst	= 3;
 
+static Move::AffectedNets::iterator findAffectedNet(Move::AffectedNets& affectedNets, unsigned netId)
+{
+    Move::AffectedNets::iterator anit = affectedNets.begin();
+    while ((anit != affectedNets.end()) && (anit->first != netId))
+        ++anit;
+    return anit;
+}
+
 double Move::getDeltaNetCost()
 {
     // Find affected nets
     // ==================
+    // An instance has only a handful of nets: a small vector with a linear
+    // search avoids a map node allocation per net on each move. It is sorted
+    // afterwards so the nets are visited in the same order as before.
     _affectedNets.clear();
     for (MaukaEngine::UVector::const_iterator uvit = _mauka->_instanceNets[_srcIns].begin();
             uvit != _mauka->_instanceNets[_srcIns].end();
             uvit++)
     {
-        _affectedNets[*uvit] = NetSrc;
+        if (findAffectedNet(_affectedNets, *uvit) == _affectedNets.end())
+            _affectedNets.push_back(make_pair(*uvit, NetSrc));
     }
 
     if (_exchange)
@@ -160,13 +172,15 @@ double Move::getDeltaNetCost()
                 uvit++)
         {
             unsigned netId = *uvit;
-            if (_affectedNets.find(netId) == _affectedNets.end())
-                _affectedNets[netId] = NetDst;
+            AffectedNets::iterator anit = findAffectedNet(_affectedNets, netId);
+            if (anit == _affectedNets.end())
+                _affectedNets.push_back(make_pair(netId, NetDst));
             else
-                if (_affectedNets[netId] != NetDst)
-                _affectedNets[netId] = NetSrcDst;
+                if (anit->second != NetDst)
+                anit->second = NetSrcDst;
         }
     }
+    sort(_affectedNets.begin(), _affectedNets.end());
     
     // compute delta
     // =============
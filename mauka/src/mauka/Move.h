@@ -35,7 +35,8 @@
 // Authors-Tag 
 #ifndef __MOVE_H
 #define __MOVE_H
-#include <map>
+#include <vector>
+#include <utility>
 
 #include "hurricane/Instance.h"
 #include "hurricane/Net.h"
@@ -57,7 +58,7 @@ class Move {
 
 // Types
 // *****
-    public: typedef std::map<unsigned, unsigned> AffectedNets;
+    public: typedef std::vector< std::pair<unsigned, unsigned> > AffectedNets;
             
 // Attributes
 // **********
@@ -126,9 +126,11 @@ namespace Solstice {
   
   void  SolsticeEngine::_depthCreate(Cell * cell)
   {
+    set<Cell*> masters;
     forEach(Instance*,instance, cell->getInstances())
       {
 	Cell * subcell = (*instance)->getMasterCell();
+	if(!masters.insert(subcell).second) continue;
 	SolsticeEngine * solstice = get(subcell);
 	if( (!(subcell->isTerminalNetlist())) && (!solstice) ) {
 	  _depthCreate(subcell); 
@@ -204,6 +206,9 @@ namespace Solstice {
       throw Error("Can't do comparison, because the extraction haven't been done");
     }
     
+    cmess1 << "  o  Comparing <" << getString(_cell->getName()) << ">" << endl;
+    startMeasures();
+
     //  Create CEngine Solstice for all models except standards models.
     // *****************************************************************
     _depthCreate(_cell);    
@@ -215,7 +220,10 @@ namespace Solstice {
     //  Run comparison and Print Statistique datas.
     // *********************************************
     runComparison();
-    
+
+    stopMeasures();
+    cmess1 << Dots::asSizet( "     - Routing errors", _routingErrors->size() ) << endl;
+    printMeasures();
   }  
   
   
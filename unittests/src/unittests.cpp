@@ -1,5 +1,11 @@
 
 
+#include  <cstdio>
+#include  <cstdlib>
+#include  <unistd.h>
+#include  <new>
+#include  <chrono>
+#include  <iomanip>
 #include  <boost/program_options.hpp>
 namespace boptions = boost::program_options;
 
@@ -7,6 +13,14 @@ namespace boptions = boost::program_options;
 #include "hurricane/Interval.h"
 #include "hurricane/RbTree.h"
 #include "hurricane/IntervalTree.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Library.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/Instance.h"
+#include "hurricane/Plug.h"
+#include "hurricane/UpdateSession.h"
+#include "hurricane/JsonWriter.h"
 #include "crlcore/Utilities.h"
 
 namespace Hurricane {
@@ -30,6 +44,22 @@ using namespace Hurricane;
 using namespace CRL;
 
 
+// -------------------------------------------------------------------
+// Heap allocation counter (for "benchCollections").
+
+size_t  heapAllocations = 0;
+
+void* operator new ( size_t size )
+{
+  ++heapAllocations;
+  void* p = malloc( size ? size : 1 );
+  if (not p) throw bad_alloc();
+  return p;
+}
+
+void  operator delete ( void* p ) noexcept { free( p ); }
+
+
 namespace {
 
   using namespace std;
@@ -37,6 +67,48 @@ namespace {
 
 
   inline DbU::Unit  l ( long v ) { return DbU::fromLambda(v); }
+
+
+// -------------------------------------------------------------------
+// Class  :  "TemporaryFile".
+//
+// Unique file name in $TMPDIR (or /tmp), removed when going out of scope.
+
+  class TemporaryFile {
+    public:
+                            TemporaryFile ( string stem, string suffix );
+                           ~TemporaryFile ();
+      inline const string&  getPath       () const;
+    private:
+                            TemporaryFile ( const TemporaryFile& );
+             TemporaryFile& operator=     ( const TemporaryFile& );
+    private:
+      string  _path;
+  };
+
+
+  TemporaryFile::TemporaryFile ( string stem, string suffix )
+    : _path()
+  {
+    const char* tmpDir = getenv( "TMPDIR" );
+    string      path   = string( (tmpDir) ? tmpDir : "/tmp" ) + "/" + stem + ".XXXXXX" + suffix;
+
+    vector<char> buffer ( path.begin(), path.end() );
+    buffer.push_back( '\0' );
+    int fd = mkstemps( buffer.data(), suffix.size() );
+    if (fd < 0)
+      throw Error( "TemporaryFile::TemporaryFile(): Unable to create \"%s\"."
+                 , path.c_str() );
+    close( fd );
+    _path = buffer.data();
+  }
+
+
+  TemporaryFile::~TemporaryFile ()
+  { remove( _path.c_str() ); }
+
+
+  inline const string& TemporaryFile::getPath () const { return _path; }
   
   
 // -------------------------------------------------------------------
@@ -134,6 +206,179 @@ namespace {
 
     return 0;
   }
+  
+  
+// -------------------------------------------------------------------
+// Test  :  "testJsonRoundTrip".
+
+
+  int  testJsonRoundTrip ()
+  {
+    DataBase* db = DataBase::getDB();
+    if (not db) db = DataBase::create();
+
+    Library* root = db->getRootLibrary();
+    if (not root) root = Library::create( db, "root" );
+    Library* work = Library::create( root, "json_work" );
+
+    UpdateSession::open();
+    Cell* leaf = Cell::create( work, "json_leaf" );
+    Net*  i    = Net::create( leaf, "i" );
+    Net*  q    = Net::create( leaf, "q" );
+    i->setExternal( true );
+    q->setExternal( true );
+
+    Cell* top = Cell::create( work, "json_top" );
+    Net*  a   = Net::create( top, "a" );
+    Net*  b   = Net::create( top, "b" );
+    Net*  c   = Net::create( top, "c" );
+    for ( size_t j=0 ; j<2 ; ++j ) {
+      Instance* instance = Instance::create( top, "leaf_"+getString(j), leaf );
+      instance->getPlug( i )->setNet( (j) ? b : a );
+      instance->getPlug( q )->setNet( (j) ? c : b );
+    }
+    UpdateSession::close();
+
+    size_t instances  = top->getInstances().getSize();
+    size_t nets       = top->getNets().getSize();
+    size_t components = b->getComponents().getSize();
+    size_t plugs      = top->getInstance( "leaf_0" )->getPlugs().getSize();
+
+    TemporaryFile blob ( "json_top", ".json.bz2" );
+    { JsonWriter writer ( blob.getPath() );
+      jsonWrite( &writer, top );
+    }
+  // Free the name so the reloaded cell does not collide with the original one.
+    top->setName( "json_top_saved" );
+
+    Cell* loaded = Cell::fromJson( blob.getPath() );
+    if (not loaded) {
+      cerr << "[ERROR] testJsonRoundTrip(): Cell::fromJson() returned NULL." << endl;
+      return 1;
+    }
+
+    int errors = 0;
+    if (loaded->getInstances().getSize() != instances) {
+      cerr << "[ERROR] testJsonRoundTrip(): Instances " << loaded->getInstances().getSize()
+           << " (expected " << instances << ")." << endl;
+      ++errors;
+    }
+    if (loaded->getNets().getSize() != nets) {
+      cerr << "[ERROR] testJsonRoundTrip(): Nets " << loaded->getNets().getSize()
+           << " (expected " << nets << ")." << endl;
+      ++errors;
+    }
+    Net* lb = loaded->getNet( "b" );
+    if (not lb or (lb->getComponents().getSize() != components)) {
+      cerr << "[ERROR] testJsonRoundTrip(): Components of \"b\" "
+           << ((lb) ? lb->getComponents().getSize() : 0)
+           << " (expected " << components << ")." << endl;
+      ++errors;
+    }
+    Instance* linstance = loaded->getInstance( "leaf_0" );
+    if (not linstance or (linstance->getPlugs().getSize() != plugs)) {
+      cerr << "[ERROR] testJsonRoundTrip(): Plugs of \"leaf_0\" "
+           << ((linstance) ? linstance->getPlugs().getSize() : 0)
+           << " (expected " << plugs << ")." << endl;
+      ++errors;
+    }
+
+    if (not errors) cerr << "JSON round trip of <" << getString(top->getName()) << "> Ok." << endl;
+    return errors;
+  }
+
+
+  
+// -------------------------------------------------------------------
+// Test  :  "benchCollections".
+//
+// Compare, on the intrusive collections, the range-for over the
+// concrete Elements with the one through a GenericCollection, which
+// clones the collection and allocates a Locator at each loop.
+
+  template< typename Loop >
+  bool  measureLoop ( const char* label, size_t loops, Loop loop )
+  {
+    size_t allocations = heapAllocations;
+    auto   start       = chrono::steady_clock::now();
+    size_t elements    = 0;
+
+    for ( size_t i=0 ; i<loops ; ++i ) elements += loop();
+
+    double seconds = chrono::duration<double>( chrono::steady_clock::now() - start ).count();
+    allocations    = heapAllocations - allocations;
+
+    cerr << "  " << left << setw(36) << label << right
+         << " elements/loop:"    << setw(6) << (elements    / loops)
+         << " allocations/loop:" << setw(6) << ((double)allocations / loops)
+         << " time/loop:"        << setw(9) << fixed << setprecision(3) << (seconds / loops * 1e6)
+         << defaultfloat << "us" << endl;
+    return allocations == 0;
+  }
+
+
+  int  benchCollections ()
+  {
+    const size_t netCount = 2000;
+    const size_t loops    = 1000;
+
+    DataBase* db = DataBase::getDB();
+    if (not db) db = DataBase::create();
+
+    Library* root = db->getRootLibrary();
+    if (not root) root = Library::create( db, "root" );
+    Library* work = Library::create( root, "bench_work" );
+
+    UpdateSession::open();
+    Cell* leaf = Cell::create( work, "bench_leaf" );
+    Net*  i    = Net::create( leaf, "i" );
+    Net*  q    = Net::create( leaf, "q" );
+    i->setExternal( true );
+    q->setExternal( true );
+
+    Cell* top = Cell::create( work, "bench_top" );
+    Net*  clk = Net::create( top, "clk" );
+    for ( size_t j=0 ; j<netCount ; ++j ) {
+      Net*      net      = Net::create( top, "n_"+getString(j) );
+      Instance* instance = Instance::create( top, "leaf_"+getString(j), leaf );
+      instance->getPlug( i )->setNet( clk );
+      instance->getPlug( q )->setNet( net );
+    }
+    UpdateSession::close();
+
+    cerr << "Range-for over the intrusive collections of <bench_top> ("
+         << netCount << " nets & instances, " << loops << " loops)." << endl;
+
+    int errors = 0;
+    measureLoop( "Cell::getNets() (Collection)"
+               , loops, [&] () { size_t n=0; for ( Net* net : Nets(top->getNets()) ) n += (net != NULL); return n; } );
+    if (not measureLoop( "Cell::getNets() (Elements)"
+                       , loops, [&] () { size_t n=0; for ( Net* net : top->getNets() ) n += (net != NULL); return n; } ))
+      ++errors;
+
+    measureLoop( "Cell::getInstances() (Collection)"
+               , loops, [&] () { size_t n=0; for ( Instance* inst : Instances(top->getInstances()) ) n += (inst != NULL); return n; } );
+    if (not measureLoop( "Cell::getInstances() (Elements)"
+                       , loops, [&] () { size_t n=0; for ( Instance* inst : top->getInstances() ) n += (inst != NULL); return n; } ))
+      ++errors;
+
+    measureLoop( "Net::getComponents() (Collection)"
+               , loops, [&] () { size_t n=0; for ( Component* comp : Components(clk->getComponents()) ) n += (comp != NULL); return n; } );
+    if (not measureLoop( "Net::getComponents() (Elements)"
+                       , loops, [&] () { size_t n=0; for ( Component* comp : clk->getComponents() ) n += (comp != NULL); return n; } ))
+      ++errors;
+
+    Instance* instance = top->getInstance( "leaf_0" );
+    measureLoop( "Instance::getPlugs() (Collection)"
+               , loops, [&] () { size_t n=0; for ( Plug* plug : Plugs(instance->getPlugs()) ) n += (plug != NULL); return n; } );
+    if (not measureLoop( "Instance::getPlugs() (Elements)"
+                       , loops, [&] () { size_t n=0; for ( Plug* plug : instance->getPlugs() ) n += (plug != NULL); return n; } ))
+      ++errors;
+
+    if (errors)
+      cerr << "[ERROR] benchCollections(): " << errors << " Elements loop(s) allocated on the heap." << endl;
+    return errors;
+  }
 
   
 }  // Anonymous namespace.
@@ -144,9 +389,11 @@ int main ( int argc, char* argv[] )
   int  returnCode = 0;
 
   try {
-    bool coreDump = false;
-    bool rbTree   = false;
-    bool intvTree = false;
+    bool coreDump  = false;
+    bool rbTree    = false;
+    bool intvTree  = false;
+    bool json      = false;
+    bool benchColl = false;
 
     boptions::options_description options ("Command line arguments & options");
     options.add_options()
@@ -156,7 +403,11 @@ int main ( int argc, char* argv[] )
       ( "rb-tree"    , boptions::bool_switch(&rbTree  )->default_value(false)
                      , "Test of the red/black tree \"hurricane/RbTree.h\".")
       ( "intv-tree"  , boptions::bool_switch(&intvTree)->default_value(false)
-                     , "Test of the interval tree \"hurricane/IntervalTree.h\".");
+                     , "Test of the interval tree \"hurricane/IntervalTree.h\".")
+      ( "json"       , boptions::bool_switch(&json    )->default_value(false)
+                     , "Save then reload a small hierarchy through JSON.")
+      ( "bench-coll" , boptions::bool_switch(&benchColl)->default_value(false)
+                     , "Count heap allocations & time of range-for over intrusive collections.");
 
     boptions::variables_map arguments;
     boptions::store ( boptions::parse_command_line(argc,argv,options), arguments );
@@ -173,6 +424,8 @@ int main ( int argc, char* argv[] )
 
     if (rbTree  ) returnCode += testRbTree();
     if (intvTree) returnCode += testIntervalTree();
+    if (json    ) returnCode += testJsonRoundTrip();
+    if (benchColl) returnCode += benchCollections();
 
     DebugSession::close();
   }